@@ -0,0 +1,187 @@
+/**
+ * Micro-benchmarks for the Wheel C stdlib
+ * Times the hot entry points every compiled Wheel program links:
+ * allocator churn, block I/O, process spawn and random generation.
+ * Output is machine-readable (JSON lines by default, CSV with --csv)
+ * for regression tracking across wheelc releases.
+ *
+ * Build and run with: make bench
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+// Stdlib entry points under test (no shared headers in the stdlib;
+// each library exposes plain C symbols)
+void* mem_alloc(size_t size);
+void mem_free(void* ptr);
+int fs_open(const char* device);
+void fs_close(int handle);
+long fs_read_block(int handle, long block_num, void* buffer);
+long fs_write_block(int handle, long block_num, const void* buffer);
+long fs_cache_init(int handle, long n_blocks);
+long process_create_argv(const char* path, char* const argv[]);
+long process_wait(long pid_handle);
+long luck_random(long max);
+void luck_fill(long* buffer, long count, long max);
+int64_t wheel_time_monotonic_ns(void);
+
+#define WARMUP_REPS 1
+#define TIMED_REPS 3
+
+static int csv_output = 0;
+
+static void report(const char* name, const char* unit, double value) {
+    if (csv_output) {
+        printf("%s,%s,%.2f\n", name, unit, value);
+    } else {
+        printf("{\"benchmark\":\"%s\",\"unit\":\"%s\",\"value\":%.2f}\n",
+               name, unit, value);
+    }
+}
+
+// Run fn() WARMUP_REPS + TIMED_REPS times and report the best timed rep
+static void run_bench(const char* name, const char* unit, double (*fn)(void)) {
+    double best = 0.0;
+    for (int rep = 0; rep < WARMUP_REPS + TIMED_REPS; rep++) {
+        double value = fn();
+        if (rep >= WARMUP_REPS && (best == 0.0 || value > best)) {
+            best = value;
+        }
+    }
+    report(name, unit, best);
+}
+
+// ----- allocator: mixed-size alloc/free churn ------------------------------
+
+#define MEM_OPS 200000
+
+static double bench_mem_churn(void) {
+    static void* slots[256];
+    int64_t t0 = wheel_time_monotonic_ns();
+    for (long i = 0; i < MEM_OPS; i++) {
+        int s = i & 255;
+        if (slots[s]) {
+            mem_free(slots[s]);
+            slots[s] = 0;
+        } else {
+            slots[s] = mem_alloc(32 + (i * 7) % 1000);
+        }
+    }
+    int64_t t1 = wheel_time_monotonic_ns();
+    for (int s = 0; s < 256; s++) {
+        if (slots[s]) {
+            mem_free(slots[s]);
+            slots[s] = 0;
+        }
+    }
+    return MEM_OPS / ((t1 - t0) / 1e9);  // ops/sec
+}
+
+// ----- filesystem: sequential block read throughput ------------------------
+
+#define FS_BLOCKS 4096  // 2MB at 512-byte sectors
+static const char* bench_file = "/tmp/wheel_bench.dat";
+
+static double bench_fs_read(void) {
+    int h = fs_open(bench_file);
+    if (h < 0) return 0.0;
+    char buf[512];
+    int64_t t0 = wheel_time_monotonic_ns();
+    for (long b = 0; b < FS_BLOCKS; b++) {
+        fs_read_block(h, b, buf);
+    }
+    int64_t t1 = wheel_time_monotonic_ns();
+    fs_close(h);
+    return (FS_BLOCKS * 512.0 / (1024 * 1024)) / ((t1 - t0) / 1e9);  // MB/s
+}
+
+static double bench_fs_read_cached(void) {
+    int h = fs_open(bench_file);
+    if (h < 0) return 0.0;
+    fs_cache_init(h, 64);
+    char buf[512];
+    // Hot set of 64 blocks read round-robin: all hits after first pass
+    for (int pass = 0; pass < 2; pass++) {
+        for (long b = 0; b < 64; b++) {
+            fs_read_block(h, b, buf);
+        }
+    }
+    int64_t t0 = wheel_time_monotonic_ns();
+    for (long i = 0; i < FS_BLOCKS; i++) {
+        fs_read_block(h, i % 64, buf);
+    }
+    int64_t t1 = wheel_time_monotonic_ns();
+    fs_close(h);
+    return (FS_BLOCKS * 512.0 / (1024 * 1024)) / ((t1 - t0) / 1e9);  // MB/s
+}
+
+// ----- process: spawn + wait rate ------------------------------------------
+
+#define SPAWN_COUNT 50
+
+static double bench_spawn(void) {
+    char* argv[] = {"true", NULL};
+    int64_t t0 = wheel_time_monotonic_ns();
+    for (int i = 0; i < SPAWN_COUNT; i++) {
+        long h = process_create_argv("/bin/true", argv);
+        if (h < 0) return 0.0;
+        process_wait(h);
+    }
+    int64_t t1 = wheel_time_monotonic_ns();
+    return SPAWN_COUNT / ((t1 - t0) / 1e9);  // spawns/sec
+}
+
+// ----- luck: random number throughput --------------------------------------
+
+#define LUCK_DRAWS 10000000
+
+static double bench_luck_random(void) {
+    long sink = 0;
+    int64_t t0 = wheel_time_monotonic_ns();
+    for (long i = 0; i < LUCK_DRAWS; i++) {
+        sink += luck_random(999);
+    }
+    int64_t t1 = wheel_time_monotonic_ns();
+    // Keep the loop from being optimized out
+    if (sink == 42) putchar(' ');
+    return LUCK_DRAWS / ((t1 - t0) / 1e9);  // draws/sec
+}
+
+static double bench_luck_fill(void) {
+    static long buf[LUCK_DRAWS / 10];
+    int64_t t0 = wheel_time_monotonic_ns();
+    luck_fill(buf, LUCK_DRAWS / 10, 999);
+    int64_t t1 = wheel_time_monotonic_ns();
+    return (LUCK_DRAWS / 10) / ((t1 - t0) / 1e9);  // values/sec
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "--csv") == 0) {
+        csv_output = 1;
+        printf("benchmark,unit,value\n");
+    }
+
+    // Benchmark data file: FS_BLOCKS sectors of zeroes
+    int fd = open(bench_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+        char zero[512] = {0};
+        for (long b = 0; b < FS_BLOCKS; b++) {
+            if (write(fd, zero, 512) != 512) break;
+        }
+        close(fd);
+    }
+
+    run_bench("mem_alloc_free_churn", "ops/sec", bench_mem_churn);
+    run_bench("fs_read_block_seq", "MB/sec", bench_fs_read);
+    run_bench("fs_read_block_cached", "MB/sec", bench_fs_read_cached);
+    run_bench("process_spawn_wait", "spawns/sec", bench_spawn);
+    run_bench("luck_random", "draws/sec", bench_luck_random);
+    run_bench("luck_fill", "values/sec", bench_luck_fill);
+
+    unlink(bench_file);
+    return 0;
+}
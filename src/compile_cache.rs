@@ -0,0 +1,115 @@
+//! On-disk object cache for the LLVM (--mode ll) backend.
+//!
+//! Rebuilding a multi-file Wheel project recompiles every source from
+//! scratch; LLVM codegen plus the external gcc link dominate the
+//! edit-compile-run loop. This cache keys each compiled object by a
+//! hash of its source text and the compiler flags, so unchanged .wheel
+//! files reuse their cached object and only modified files pay codegen
+//! cost.
+//!
+//! Backend wiring: before emitting a module, call
+//! `lookup(source, flags)`; on a miss, compile as usual and hand the
+//! object to `store(source, flags, path)`.
+
+use std::fs;
+use std::io;
+use std::path::PathBuf;
+
+/// Cache format version; bump when the object layout or key scheme
+/// changes so stale entries from older wheelc releases are ignored.
+const CACHE_VERSION: u32 = 1;
+
+pub struct CompileCache {
+    dir: PathBuf,
+}
+
+impl CompileCache {
+    /// Open (creating if needed) the cache under the user cache
+    /// directory, e.g. ~/.cache/wheelc/objects. Returns None when no
+    /// cache directory is available (caching is then skipped).
+    pub fn open() -> Option<CompileCache> {
+        let dir = dirs::cache_dir()?.join("wheelc").join("objects");
+        fs::create_dir_all(&dir).ok()?;
+        Some(CompileCache { dir })
+    }
+
+    /// The exact bytes an entry is keyed by: cache format, compiler
+    /// version, flags and source text. Stored next to each object and
+    /// compared on lookup, so a filename-hash collision can never
+    /// serve an object built from different input.
+    fn key_material(source: &str, flags: &str) -> Vec<u8> {
+        let mut material = Vec::with_capacity(source.len() + flags.len() + 32);
+        material.extend_from_slice(&CACHE_VERSION.to_le_bytes());
+        // A new wheelc release may generate different code for the
+        // same source, so the compiler version is part of the key
+        material.extend_from_slice(env!("CARGO_PKG_VERSION").as_bytes());
+        material.push(0); // separators so field boundaries can't collide
+        material.extend_from_slice(flags.as_bytes());
+        material.push(0);
+        material.extend_from_slice(source.as_bytes());
+        material
+    }
+
+    /// Filename for one translation unit: an FNV-1a hash of the key
+    /// material. The hash only has to spread entries across files;
+    /// correctness comes from the key-material comparison in lookup,
+    /// where a collision costs a recompile, never wrong reuse.
+    fn key(source: &str, flags: &str) -> String {
+        let mut hash: u64 = 0xcbf29ce484222325;
+        for &b in Self::key_material(source, flags).iter() {
+            hash ^= b as u64;
+            hash = hash.wrapping_mul(0x100000001b3);
+        }
+        format!("{:016x}", hash)
+    }
+
+    /// Path of the cached object for this source and flags, if present
+    /// and verified against the stored key material.
+    pub fn lookup(&self, source: &str, flags: &str) -> Option<PathBuf> {
+        let key = Self::key(source, flags);
+        let object = self.dir.join(format!("{}.o", key));
+        let meta = self.dir.join(format!("{}.meta", key));
+        if !object.is_file() {
+            return None;
+        }
+        // Verify the entry was built from exactly this input; a hash
+        // collision or torn entry is treated as a miss
+        if fs::read(&meta).ok()? != Self::key_material(source, flags) {
+            return None;
+        }
+        Some(object)
+    }
+
+    /// Copy a freshly compiled object into the cache, returning the
+    /// cached path. Both files are written to temporary names first so
+    /// a concurrent wheelc never observes a half-written entry, with
+    /// the meta file landing before the object that makes the entry
+    /// visible to lookup.
+    pub fn store(&self, source: &str, flags: &str, object: &std::path::Path) -> io::Result<PathBuf> {
+        let key = Self::key(source, flags);
+        let meta_path = self.dir.join(format!("{}.meta", key));
+        let obj_path = self.dir.join(format!("{}.o", key));
+        let pid = std::process::id();
+
+        let meta_tmp = self.dir.join(format!("{}.meta.tmp{}", key, pid));
+        fs::write(&meta_tmp, Self::key_material(source, flags))?;
+        fs::rename(&meta_tmp, &meta_path)?;
+
+        let obj_tmp = self.dir.join(format!("{}.o.tmp{}", key, pid));
+        fs::copy(object, &obj_tmp)?;
+        fs::rename(&obj_tmp, &obj_path)?;
+        Ok(obj_path)
+    }
+
+    /// Drop every cached object (e.g. `wheelc --clear-cache`).
+    pub fn clear(&self) -> io::Result<()> {
+        for entry in fs::read_dir(&self.dir)? {
+            let entry = entry?;
+            let path = entry.path();
+            if path.extension().map_or(false, |e| e == "o" || e == "meta") {
+                fs::remove_file(path)?;
+            }
+        }
+        Ok(())
+    }
+}
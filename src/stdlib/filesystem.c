@@ -3,98 +3,667 @@
  * Low-level disk I/O operations
  */
 
+#define _GNU_SOURCE  // O_DIRECT
+
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
 #include <fcntl.h>
 
+#include "wheel_stats.h"
+
 #define SECTOR_SIZE 512
 
+// One cached block plus its LRU and hash-chain links
+typedef struct CacheEntry {
+    long block_num;
+    int valid;
+    int dirty;
+    struct CacheEntry* lru_prev;
+    struct CacheEntry* lru_next;
+    struct CacheEntry* hash_next;
+    char* data;
+} CacheEntry;
+
+// Per-handle LRU block cache (see fs_cache_init)
+typedef struct FSCache {
+    int capacity;
+    int n_buckets;           // power of two
+    int write_back;          // 0 = write-through (default), 1 = write-back
+    CacheEntry* entries;
+    CacheEntry** buckets;
+    CacheEntry* lru_head;    // most recently used
+    CacheEntry* lru_tail;    // eviction candidate
+    CacheEntry* free_list;   // discarded entries ready for reuse
+    int used;                // entries handed out so far (fill cursor)
+    long hits;
+    long misses;
+} FSCache;
+
 typedef struct {
     int fd;
     int block_size;
     int total_blocks;
+    int in_use;
+    unsigned generation;  // bumped on close so stale handles are caught
+    FSCache* cache;
 } FSHandle;
 
-static FSHandle fs_handles[4];
-static int fs_handle_count = 0;
+// Handle table: grows on demand, slots are recycled on close. A handle
+// value packs the slot index in the low 16 bits and the slot generation
+// in the high bits, so a handle kept across a close/reopen pair fails
+// validation instead of hitting the new occupant.
+#define FS_TABLE_INITIAL 16
+#define FS_TABLE_MAX 65536
+#define FS_GEN_MASK 0x7FFF
+
+static FSHandle* fs_handles = NULL;
+static int fs_table_capacity = 0;
+
+static void cache_destroy(FSHandle* h);
+
+// Resolve a handle to its slot, or NULL if it is invalid or stale
+static FSHandle* fs_get(int handle) {
+    if (handle < 0) return NULL;
+    int idx = handle & 0xFFFF;
+    unsigned gen = (unsigned)handle >> 16;
+    if (idx >= fs_table_capacity) return NULL;
+    FSHandle* h = &fs_handles[idx];
+    if (!h->in_use || h->generation != gen || h->fd < 0) return NULL;
+    return h;
+}
+
+static int fs_open_with_flags(const char* device, int flags) {
+    // Find a recycled slot, growing the table when all are occupied
+    int idx = -1;
+    for (int i = 0; i < fs_table_capacity; i++) {
+        if (!fs_handles[i].in_use) {
+            idx = i;
+            break;
+        }
+    }
+    if (idx < 0) {
+        if (fs_table_capacity >= FS_TABLE_MAX) return -1;
+        int cap = (fs_table_capacity == 0) ? FS_TABLE_INITIAL : fs_table_capacity * 2;
+        if (cap > FS_TABLE_MAX) cap = FS_TABLE_MAX;
+        FSHandle* table = (FSHandle*)realloc(fs_handles, cap * sizeof(FSHandle));
+        if (table == NULL) return -1;
+        for (int i = fs_table_capacity; i < cap; i++) {
+            table[i].in_use = 0;
+            table[i].generation = 0;
+            table[i].fd = -1;
+            table[i].cache = NULL;
+        }
+        idx = fs_table_capacity;
+        fs_handles = table;
+        fs_table_capacity = cap;
+    }
+    
+    int fd = open(device, flags);
+    if (fd < 0) return -1;
+    
+    FSHandle* h = &fs_handles[idx];
+    h->fd = fd;
+    h->block_size = SECTOR_SIZE;
+    h->total_blocks = 0;
+    h->in_use = 1;
+    h->generation = (h->generation % FS_GEN_MASK) + 1;  // 1..0x7FFF, never 0
+    h->cache = NULL;
+    
+    return (int)((h->generation << 16) | (unsigned)idx);
+}
 
 /**
  * Initialize filesystem on a device
  * Returns handle ID or -1 on error
  */
 int fs_open(const char* device) {
-    if (fs_handle_count >= 4) return -1;
+    return fs_open_with_flags(device, O_RDWR);
+}
+
+/**
+ * Open a device bypassing the page cache (O_DIRECT), for large
+ * sequential streams that would otherwise evict co-located services'
+ * hot data. I/O on the handle must use properly aligned buffers --
+ * acquire them from fs_buf_acquire.
+ * Returns handle ID or -1 on error
+ */
+int fs_open_direct(const char* device) {
+    return fs_open_with_flags(device, O_RDWR | O_DIRECT);
+}
+
+// Pool of reusable 4KB-aligned buffers sized for O_DIRECT transfers,
+// so callers don't each re-solve the alignment problem
+#define FS_BUF_COUNT 8
+#define FS_BUF_SIZE (64 * 1024)
+
+static _Alignas(4096) char fs_buf_pool[FS_BUF_COUNT][FS_BUF_SIZE];
+static int fs_buf_in_use[FS_BUF_COUNT];
+
+/**
+ * Grab a 4KB-aligned buffer of fs_buf_size() bytes from the pool
+ * @return: buffer pointer or 0 when the pool is exhausted
+ */
+void* fs_buf_acquire() {
+    for (int i = 0; i < FS_BUF_COUNT; i++) {
+        if (!__atomic_exchange_n(&fs_buf_in_use[i], 1, __ATOMIC_ACQUIRE)) {
+            return fs_buf_pool[i];
+        }
+    }
+    return 0;
+}
+
+/**
+ * Return a buffer obtained from fs_buf_acquire to the pool
+ */
+void fs_buf_release(void* buffer) {
+    for (int i = 0; i < FS_BUF_COUNT; i++) {
+        if (fs_buf_pool[i] == (char*)buffer) {
+            __atomic_store_n(&fs_buf_in_use[i], 0, __ATOMIC_RELEASE);
+            return;
+        }
+    }
+}
+
+/**
+ * Size in bytes of every pool buffer
+ */
+long fs_buf_size() {
+    return FS_BUF_SIZE;
+}
+
+/**
+ * Close filesystem handle
+ */
+void fs_close(int handle) {
+    FSHandle* h = fs_get(handle);
+    if (h != NULL) {
+        cache_destroy(h);
+        close(h->fd);
+        h->fd = -1;
+        h->in_use = 0;  // slot is free for reuse; generation already differs
+    }
+}
+
+// Uncached single-block I/O, shared by the public entry points and the
+// cache fill/eviction paths
+static long disk_read_block(FSHandle* h, long block_num, void* buffer) {
+    ssize_t n = pread(h->fd, buffer, h->block_size, (off_t)block_num * h->block_size);
+    return (n < 0) ? -1 : n;
+}
+
+static long disk_write_block(FSHandle* h, long block_num, const void* buffer) {
+    ssize_t n = pwrite(h->fd, buffer, h->block_size, (off_t)block_num * h->block_size);
+    return (n < 0) ? -1 : n;
+}
+
+static int cache_bucket(FSCache* c, long block_num) {
+    return (int)(((unsigned long)block_num * 2654435761u) & (c->n_buckets - 1));
+}
+
+static CacheEntry* cache_lookup(FSCache* c, long block_num) {
+    CacheEntry* e = c->buckets[cache_bucket(c, block_num)];
+    while (e != NULL) {
+        if (e->block_num == block_num) return e;
+        e = e->hash_next;
+    }
+    return NULL;
+}
+
+static void cache_lru_unlink(FSCache* c, CacheEntry* e) {
+    if (e->lru_prev != NULL) e->lru_prev->lru_next = e->lru_next;
+    else c->lru_head = e->lru_next;
+    if (e->lru_next != NULL) e->lru_next->lru_prev = e->lru_prev;
+    else c->lru_tail = e->lru_prev;
+}
+
+static void cache_lru_push_front(FSCache* c, CacheEntry* e) {
+    e->lru_prev = NULL;
+    e->lru_next = c->lru_head;
+    if (c->lru_head != NULL) c->lru_head->lru_prev = e;
+    c->lru_head = e;
+    if (c->lru_tail == NULL) c->lru_tail = e;
+}
+
+static void cache_hash_remove(FSCache* c, CacheEntry* e) {
+    CacheEntry** p = &c->buckets[cache_bucket(c, e->block_num)];
+    while (*p != NULL) {
+        if (*p == e) {
+            *p = e->hash_next;
+            return;
+        }
+        p = &(*p)->hash_next;
+    }
+}
+
+// Drop an entry from the cache (failed or short fill) and make it
+// reusable for the next miss
+static void cache_discard_entry(FSCache* c, CacheEntry* e) {
+    e->valid = 0;
+    cache_lru_unlink(c, e);
+    cache_hash_remove(c, e);
+    e->hash_next = c->free_list;
+    c->free_list = e;
+}
+
+// Take over an entry for block_num: a discarded or fresh slot if one
+// remains, otherwise the least recently used entry (written out first
+// if dirty)
+static CacheEntry* cache_take_entry(FSHandle* h, FSCache* c, long block_num) {
+    CacheEntry* e = NULL;
+    if (c->free_list != NULL) {
+        e = c->free_list;
+        c->free_list = e->hash_next;
+    } else if (c->used < c->capacity) {
+        e = &c->entries[c->used++];
+    }
+    if (e == NULL) {
+        e = c->lru_tail;
+        if (e == NULL) return NULL;
+        if (e->dirty) {
+            if (disk_write_block(h, e->block_num, e->data) < 0) return NULL;
+            e->dirty = 0;
+        }
+        cache_lru_unlink(c, e);
+        cache_hash_remove(c, e);
+    }
+    e->block_num = block_num;
+    e->valid = 1;
+    e->dirty = 0;
+    int b = cache_bucket(c, block_num);
+    e->hash_next = c->buckets[b];
+    c->buckets[b] = e;
+    cache_lru_push_front(c, e);
+    return e;
+}
+
+/**
+ * Put an LRU block cache in front of fs_read_block/fs_write_block for
+ * this handle, holding up to n_blocks blocks
+ * @return: 0 on success or -1 on error
+ */
+long fs_cache_init(int handle, long n_blocks) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || n_blocks <= 0 || h->cache != NULL) return -1;
     
-    int fd = open(device, O_RDWR);
-    if (fd < 0) return -1;
+    FSCache* c = (FSCache*)malloc(sizeof(FSCache));
+    if (c == NULL) return -1;
+    
+    int n_buckets = 1;
+    while (n_buckets < n_blocks) n_buckets <<= 1;
     
-    fs_handles[fs_handle_count].fd = fd;
-    fs_handles[fs_handle_count].block_size = SECTOR_SIZE;
-    fs_handles[fs_handle_count].total_blocks = 0;
+    c->capacity = (int)n_blocks;
+    c->n_buckets = n_buckets;
+    c->write_back = 0;
+    c->lru_head = NULL;
+    c->lru_tail = NULL;
+    c->free_list = NULL;
+    c->used = 0;
+    c->hits = 0;
+    c->misses = 0;
+    c->entries = (CacheEntry*)malloc(n_blocks * sizeof(CacheEntry));
+    c->buckets = (CacheEntry**)malloc(n_buckets * sizeof(CacheEntry*));
+    char* data = (c->entries != NULL) ? (char*)malloc(n_blocks * h->block_size) : NULL;
+    if (c->entries == NULL || c->buckets == NULL || data == NULL) {
+        free(data);
+        free(c->buckets);
+        free(c->entries);
+        free(c);
+        return -1;
+    }
+    for (long i = 0; i < n_blocks; i++) {
+        c->entries[i].valid = 0;
+        c->entries[i].data = data + i * h->block_size;
+    }
+    memset(c->buckets, 0, n_buckets * sizeof(CacheEntry*));
     
-    return fs_handle_count++;
+    h->cache = c;
+    return 0;
 }
 
 /**
- * Close filesystem handle
+ * Select the write mode: 0 = write-through (default), 1 = write-back
+ * (dirty blocks reach disk on eviction, fs_cache_flush or fs_sync)
+ * @return: 0 on success or -1 on error
  */
-void fs_close(int handle) {
-    if (handle >= 0 && handle < fs_handle_count) {
-        close(fs_handles[handle].fd);
-        fs_handles[handle].fd = -1;
+long fs_cache_set_mode(int handle, long write_back) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || h->cache == NULL) return -1;
+    h->cache->write_back = (write_back != 0);
+    return 0;
+}
+
+/**
+ * Write every dirty cached block back to disk
+ * @return: 0 on success or -1 on error
+ */
+static long cache_flush_h(FSHandle* h) {
+    FSCache* c = h->cache;
+    if (c == NULL) return -1;
+    
+    for (int i = 0; i < c->capacity; i++) {
+        CacheEntry* e = &c->entries[i];
+        if (e->valid && e->dirty) {
+            if (disk_write_block(h, e->block_num, e->data) < 0) return -1;
+            e->dirty = 0;
+        }
     }
+    return 0;
+}
+
+long fs_cache_flush(int handle) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return -1;
+    return cache_flush_h(h);
+}
+
+/**
+ * Cache hit count (reads and writes served from memory)
+ */
+long fs_cache_get_hits(int handle) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || h->cache == NULL) return -1;
+    return h->cache->hits;
 }
 
 /**
- * Read block from disk
+ * Cache miss count
+ */
+long fs_cache_get_misses(int handle) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || h->cache == NULL) return -1;
+    return h->cache->misses;
+}
+
+// Flush and free a handle's cache (used by fs_close)
+static void cache_destroy(FSHandle* h) {
+    FSCache* c = h->cache;
+    if (c == NULL) return;
+    cache_flush_h(h);
+    free(c->entries[0].data);  // one contiguous data arena for all entries
+    free(c->buckets);
+    free(c->entries);
+    free(c);
+    h->cache = NULL;
+}
+
+/**
+ * Read block from disk (served from the block cache when one is
+ * configured with fs_cache_init)
  * @param handle: filesystem handle
  * @param block_num: block number to read
- * @param buffer: destination buffer (must be at least SECTOR_SIZE bytes)
+ * @param buffer: destination buffer (must be at least block_size bytes)
  * @return: number of bytes read or -1 on error
  */
 long fs_read_block(int handle, long block_num, void* buffer) {
-    if (handle < 0 || handle >= fs_handle_count) return -1;
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return -1;
     
-    int fd = fs_handles[handle].fd;
-    if (fd < 0) return -1;
+    wheel_stat_add(WHEEL_STAT_FS_BLOCKS_READ, 1);
+    wheel_stat_add(WHEEL_STAT_FS_BYTES_READ, h->block_size);
     
-    off_t offset = block_num * SECTOR_SIZE;
-    if (lseek(fd, offset, SEEK_SET) < 0) return -1;
+    FSCache* c = h->cache;
+    if (c != NULL) {
+        CacheEntry* e = cache_lookup(c, block_num);
+        if (e != NULL) {
+            c->hits++;
+            cache_lru_unlink(c, e);
+            cache_lru_push_front(c, e);
+            memcpy(buffer, e->data, h->block_size);
+            return h->block_size;
+        }
+        c->misses++;
+        e = cache_take_entry(h, c, block_num);
+        if (e == NULL) return -1;
+        long n = disk_read_block(h, block_num, e->data);
+        if (n < h->block_size) {
+            // Error or short read (e.g. past EOF): don't keep the
+            // entry, or later hits would report a full block where the
+            // uncached path keeps returning the true byte count
+            cache_discard_entry(c, e);
+            if (n < 0) return -1;
+            memcpy(buffer, e->data, n);
+            return n;
+        }
+        memcpy(buffer, e->data, h->block_size);
+        return n;
+    }
     
-    ssize_t bytes_read = read(fd, buffer, SECTOR_SIZE);
-    return (bytes_read < 0) ? -1 : bytes_read;
+    return disk_read_block(h, block_num, buffer);
 }
 
 /**
- * Write block to disk
+ * Write block to disk (through or behind the block cache depending on
+ * fs_cache_set_mode)
  * @param handle: filesystem handle
  * @param block_num: block number to write
- * @param buffer: source buffer (must be at least SECTOR_SIZE bytes)
+ * @param buffer: source buffer (must be at least block_size bytes)
  * @return: number of bytes written or -1 on error
  */
 long fs_write_block(int handle, long block_num, const void* buffer) {
-    if (handle < 0 || handle >= fs_handle_count) return -1;
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return -1;
     
-    int fd = fs_handles[handle].fd;
-    if (fd < 0) return -1;
+    wheel_stat_add(WHEEL_STAT_FS_BLOCKS_WRITTEN, 1);
+    wheel_stat_add(WHEEL_STAT_FS_BYTES_WRITTEN, h->block_size);
     
-    off_t offset = block_num * SECTOR_SIZE;
-    if (lseek(fd, offset, SEEK_SET) < 0) return -1;
+    FSCache* c = h->cache;
+    if (c != NULL) {
+        CacheEntry* e = cache_lookup(c, block_num);
+        if (e != NULL) {
+            c->hits++;
+            cache_lru_unlink(c, e);
+            cache_lru_push_front(c, e);
+        } else {
+            c->misses++;
+            e = cache_take_entry(h, c, block_num);
+            if (e == NULL) return -1;
+        }
+        memcpy(e->data, buffer, h->block_size);
+        if (c->write_back) {
+            e->dirty = 1;
+            return h->block_size;
+        }
+        e->dirty = 0;
+        return disk_write_block(h, block_num, buffer);
+    }
+    
+    return disk_write_block(h, block_num, buffer);
+}
+
+/**
+ * Read a contiguous range of blocks in one positioned syscall
+ * @param start_block: first block number
+ * @param count: number of blocks
+ * @param buffer: destination buffer (count * block_size bytes)
+ * @return: number of bytes read or -1 on error
+ */
+long fs_read_blocks(int handle, long start_block, long count, void* buffer) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || count <= 0) return -1;
+    
+    int fd = h->fd;
+    int bs = h->block_size;
+    size_t total = (size_t)count * bs;
+    off_t offset = (off_t)start_block * bs;
+    
+    // Loop to cover short reads; a sequential scan is still one syscall
+    // in the common case
+    size_t done = 0;
+    while (done < total) {
+        ssize_t n = pread(fd, (char*)buffer + done, total - done, offset + done);
+        if (n < 0) return -1;
+        if (n == 0) break;  // end of file
+        done += n;
+    }
+    wheel_stat_add(WHEEL_STAT_FS_BLOCKS_READ, done / bs);
+    wheel_stat_add(WHEEL_STAT_FS_BYTES_READ, done);
+    return (long)done;
+}
+
+/**
+ * Write a contiguous range of blocks in one positioned syscall
+ * @return: number of bytes written or -1 on error
+ */
+long fs_write_blocks(int handle, long start_block, long count, const void* buffer) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || count <= 0) return -1;
+    
+    int fd = h->fd;
+    int bs = h->block_size;
+    size_t total = (size_t)count * bs;
+    off_t offset = (off_t)start_block * bs;
+    
+    size_t done = 0;
+    while (done < total) {
+        ssize_t n = pwrite(fd, (const char*)buffer + done, total - done, offset + done);
+        if (n < 0) return -1;
+        done += n;
+    }
+    wheel_stat_add(WHEEL_STAT_FS_BLOCKS_WRITTEN, done / bs);
+    wheel_stat_add(WHEEL_STAT_FS_BYTES_WRITTEN, done);
+    return (long)done;
+}
+
+#define FS_IOV_BATCH 1024  // matches the kernel's IOV_MAX
+
+/**
+ * Scatter a contiguous block range into separate per-block buffers
+ * with preadv, batching FS_IOV_BATCH blocks per syscall
+ * @param buffers: array of count buffers, one block each
+ * @return: number of bytes read or -1 on error
+ */
+long fs_readv_blocks(int handle, long start_block, long count, void** buffers) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || count <= 0 || buffers == NULL) return -1;
+    
+    int fd = h->fd;
+    int bs = h->block_size;
+    long total_read = 0;
+    
+    for (long base = 0; base < count; base += FS_IOV_BATCH) {
+        long n = count - base;
+        if (n > FS_IOV_BATCH) n = FS_IOV_BATCH;
+        
+        struct iovec iov[FS_IOV_BATCH];
+        for (long i = 0; i < n; i++) {
+            iov[i].iov_base = buffers[base + i];
+            iov[i].iov_len = bs;
+        }
+        
+        off_t offset = (off_t)(start_block + base) * bs;
+        ssize_t got = preadv(fd, iov, (int)n, offset);
+        if (got < 0) return -1;
+        total_read += got;
+        if (got < (ssize_t)n * bs) break;  // end of file
+    }
+    wheel_stat_add(WHEEL_STAT_FS_BLOCKS_READ, total_read / bs);
+    wheel_stat_add(WHEEL_STAT_FS_BYTES_READ, total_read);
+    return total_read;
+}
+
+/**
+ * Gather separate per-block buffers into a contiguous block range
+ * with pwritev, batching FS_IOV_BATCH blocks per syscall
+ * @return: number of bytes written or -1 on error
+ */
+long fs_writev_blocks(int handle, long start_block, long count, void** buffers) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || count <= 0 || buffers == NULL) return -1;
+    
+    int fd = h->fd;
+    int bs = h->block_size;
+    long total_written = 0;
+    
+    for (long base = 0; base < count; base += FS_IOV_BATCH) {
+        long n = count - base;
+        if (n > FS_IOV_BATCH) n = FS_IOV_BATCH;
+        
+        struct iovec iov[FS_IOV_BATCH];
+        for (long i = 0; i < n; i++) {
+            iov[i].iov_base = buffers[base + i];
+            iov[i].iov_len = bs;
+        }
+        
+        off_t offset = (off_t)(start_block + base) * bs;
+        ssize_t put = pwritev(fd, iov, (int)n, offset);
+        if (put < 0) return -1;
+        total_written += put;
+    }
+    wheel_stat_add(WHEEL_STAT_FS_BLOCKS_WRITTEN, total_written / bs);
+    wheel_stat_add(WHEEL_STAT_FS_BYTES_WRITTEN, total_written);
+    return total_written;
+}
+
+/**
+ * Map a region of the file directly into memory: reads become pointer
+ * arithmetic into the page cache, with zero copies, and the kernel
+ * shares the pages across processes mapping the same file
+ * @param offset: byte offset into the file (page aligned)
+ * @param length: bytes to map
+ * @return: pointer to the mapping or 0 on error
+ */
+void* fs_map(int handle, long offset, long length) {
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return 0;
+    if (length <= 0 || offset < 0 || (offset & 4095) != 0) return 0;
+    
+    int fd = h->fd;
+    
+    void* addr = mmap(NULL, (size_t)length, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, (off_t)offset);
+    return (addr == MAP_FAILED) ? 0 : addr;
+}
+
+/**
+ * Unmap a region previously returned by fs_map
+ * @return: 0 on success or -1 on error
+ */
+long fs_unmap(void* addr, long length) {
+    if (addr == 0 || length <= 0) return -1;
+    return munmap(addr, (size_t)length);
+}
+
+// Advice codes for fs_map_advise
+#define FS_ADVISE_NORMAL 0
+#define FS_ADVISE_SEQUENTIAL 1
+#define FS_ADVISE_RANDOM 2
+#define FS_ADVISE_WILLNEED 3
+
+/**
+ * Tune kernel prefetching for a mapped region
+ * @param advice: FS_ADVISE_NORMAL/SEQUENTIAL/RANDOM/WILLNEED
+ * @return: 0 on success or -1 on error
+ */
+long fs_map_advise(void* addr, long length, long advice) {
+    if (addr == 0 || length <= 0) return -1;
     
-    ssize_t bytes_written = write(fd, buffer, SECTOR_SIZE);
-    return (bytes_written < 0) ? -1 : bytes_written;
+    int madv;
+    switch (advice) {
+        case FS_ADVISE_NORMAL:     madv = MADV_NORMAL; break;
+        case FS_ADVISE_SEQUENTIAL: madv = MADV_SEQUENTIAL; break;
+        case FS_ADVISE_RANDOM:     madv = MADV_RANDOM; break;
+        case FS_ADVISE_WILLNEED:   madv = MADV_WILLNEED; break;
+        default: return -1;
+    }
+    return madvise(addr, (size_t)length, madv);
 }
 
 /**
  * Get file size
  */
 long fs_get_size(int handle) {
-    if (handle < 0 || handle >= fs_handle_count) return -1;
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return -1;
     
-    int fd = fs_handles[handle].fd;
-    if (fd < 0) return -1;
+    int fd = h->fd;
     
     struct stat sb;
     if (fstat(fd, &sb) < 0) return -1;
@@ -106,29 +675,219 @@ long fs_get_size(int handle) {
  * Sync filesystem (flush to disk)
  */
 void fs_sync(int handle) {
-    if (handle >= 0 && handle < fs_handle_count) {
-        int fd = fs_handles[handle].fd;
-        if (fd >= 0) {
-            fsync(fd);
+    FSHandle* h = fs_get(handle);
+    if (h != NULL) {
+        if (h->cache != NULL) {
+            cache_flush_h(h);
         }
+        fsync(h->fd);
     }
 }
 
 /**
- * Set block size for operations
+ * Set block size for operations. A block cache attached to the handle
+ * is flushed and rebuilt for the new size (its entry buffers are sized
+ * per block, so resizing under it would overrun them); hit/miss
+ * counters restart from zero.
  */
 void fs_set_block_size(int handle, int block_size) {
-    if (handle >= 0 && handle < fs_handle_count) {
-        fs_handles[handle].block_size = block_size;
+    FSHandle* h = fs_get(handle);
+    if (h == NULL || block_size <= 0 || h->block_size == block_size) return;
+    
+    if (h->cache != NULL) {
+        long capacity = h->cache->capacity;
+        int write_back = h->cache->write_back;
+        cache_destroy(h);  // flushes dirty blocks at the old size
+        h->block_size = block_size;
+        if (fs_cache_init(handle, capacity) == 0) {
+            h->cache->write_back = write_back;
+        }
+        return;
     }
+    h->block_size = block_size;
 }
 
 /**
  * Get current block size
  */
 int fs_get_block_size(int handle) {
-    if (handle >= 0 && handle < fs_handle_count) {
-        return fs_handles[handle].block_size;
+    FSHandle* h = fs_get(handle);
+    if (h != NULL) {
+        return h->block_size;
     }
     return -1;
 }
+
+// ---------------------------------------------------------------------------
+// Async block I/O engine backed by io_uring (raw syscalls, no liburing),
+// so one Wheel thread can keep many NVMe requests in flight and overlap
+// I/O with compute. Submissions return a request ID; completions are
+// drained from the completion queue with fs_wait_completions.
+// ---------------------------------------------------------------------------
+
+static int uring_fd = -1;
+static void* uring_sq_ring = NULL;
+static void* uring_cq_ring = NULL;
+static size_t uring_sq_ring_size = 0;
+static size_t uring_cq_ring_size = 0;
+static struct io_uring_sqe* uring_sqes = NULL;
+static size_t uring_sqes_size = 0;
+
+// Ring pointers into the shared mappings
+static unsigned* uring_sq_head;
+static unsigned* uring_sq_tail;
+static unsigned* uring_sq_mask;
+static unsigned* uring_sq_array;
+static unsigned* uring_cq_head;
+static unsigned* uring_cq_tail;
+static unsigned* uring_cq_mask;
+static struct io_uring_cqe* uring_cqes;
+
+static long uring_next_id = 1;
+
+/**
+ * Bring up the async engine with the given queue depth
+ * @return: 0 on success or -1 on error (e.g. kernel without io_uring)
+ */
+long fs_async_init(long queue_depth) {
+    if (uring_fd >= 0) return 0;  // already initialized
+    if (queue_depth <= 0) queue_depth = 32;
+    
+    struct io_uring_params p;
+    __builtin_memset(&p, 0, sizeof(p));
+    
+    int fd = (int)syscall(__NR_io_uring_setup, (unsigned)queue_depth, &p);
+    if (fd < 0) return -1;
+    
+    uring_sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    uring_cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    uring_sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    
+    uring_sq_ring = mmap(NULL, uring_sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    uring_cq_ring = mmap(NULL, uring_cq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    uring_sqes = mmap(NULL, uring_sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (uring_sq_ring == MAP_FAILED || uring_cq_ring == MAP_FAILED ||
+        uring_sqes == MAP_FAILED) {
+        if (uring_sq_ring != MAP_FAILED) munmap(uring_sq_ring, uring_sq_ring_size);
+        if (uring_cq_ring != MAP_FAILED) munmap(uring_cq_ring, uring_cq_ring_size);
+        if (uring_sqes != MAP_FAILED) munmap(uring_sqes, uring_sqes_size);
+        close(fd);
+        uring_sq_ring = uring_cq_ring = NULL;
+        uring_sqes = NULL;
+        return -1;
+    }
+    
+    char* sq = (char*)uring_sq_ring;
+    uring_sq_head = (unsigned*)(sq + p.sq_off.head);
+    uring_sq_tail = (unsigned*)(sq + p.sq_off.tail);
+    uring_sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+    uring_sq_array = (unsigned*)(sq + p.sq_off.array);
+    
+    char* cq = (char*)uring_cq_ring;
+    uring_cq_head = (unsigned*)(cq + p.cq_off.head);
+    uring_cq_tail = (unsigned*)(cq + p.cq_off.tail);
+    uring_cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+    uring_cqes = (struct io_uring_cqe*)(cq + p.cq_off.cqes);
+    
+    uring_fd = fd;
+    return 0;
+}
+
+// Queue one SQE and tell the kernel about it
+static long uring_submit(int op, int fd, void* buffer, unsigned len, off_t offset) {
+    unsigned tail = *uring_sq_tail;
+    unsigned head = __atomic_load_n(uring_sq_head, __ATOMIC_ACQUIRE);
+    if (tail - head >= *uring_sq_mask + 1) return -1;  // submission queue full
+    
+    unsigned idx = tail & *uring_sq_mask;
+    struct io_uring_sqe* sqe = &uring_sqes[idx];
+    __builtin_memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = op;
+    sqe->fd = fd;
+    sqe->addr = (unsigned long)buffer;
+    sqe->len = len;
+    sqe->off = offset;
+    
+    long id = uring_next_id++;
+    sqe->user_data = id;
+    
+    uring_sq_array[idx] = idx;
+    __atomic_store_n(uring_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    
+    if (syscall(__NR_io_uring_enter, uring_fd, 1, 0, 0, NULL, 0) < 0) return -1;
+    return id;
+}
+
+/**
+ * Submit an async block read; completion arrives via fs_wait_completions
+ * @return: request ID or -1 on error
+ */
+long fs_submit_read(int handle, long block_num, void* buffer) {
+    if (uring_fd < 0 && fs_async_init(0) < 0) return -1;
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return -1;
+    
+    int bs = h->block_size;
+    return uring_submit(IORING_OP_READ, h->fd, buffer, bs, (off_t)block_num * bs);
+}
+
+/**
+ * Submit an async block write; completion arrives via fs_wait_completions
+ * @return: request ID or -1 on error
+ */
+long fs_submit_write(int handle, long block_num, const void* buffer) {
+    if (uring_fd < 0 && fs_async_init(0) < 0) return -1;
+    FSHandle* h = fs_get(handle);
+    if (h == NULL) return -1;
+    
+    int bs = h->block_size;
+    return uring_submit(IORING_OP_WRITE, h->fd, (void*)buffer, bs, (off_t)block_num * bs);
+}
+
+/**
+ * Block until at least one request finishes, then drain completions
+ * @param ids: out array of request IDs (max entries)
+ * @param results: out array of byte counts (or negative errno), parallel to ids
+ * @return: number of completions drained or -1 on error
+ */
+long fs_wait_completions(long* ids, long* results, long max) {
+    if (uring_fd < 0 || ids == NULL || results == NULL || max <= 0) return -1;
+    
+    // Only sleep in the kernel if nothing is already waiting
+    if (__atomic_load_n(uring_cq_tail, __ATOMIC_ACQUIRE) == *uring_cq_head) {
+        if (syscall(__NR_io_uring_enter, uring_fd, 0, 1, IORING_ENTER_GETEVENTS,
+                    NULL, 0) < 0) {
+            return -1;
+        }
+    }
+    
+    long n = 0;
+    unsigned head = *uring_cq_head;
+    while (n < max &&
+           head != __atomic_load_n(uring_cq_tail, __ATOMIC_ACQUIRE)) {
+        struct io_uring_cqe* cqe = &uring_cqes[head & *uring_cq_mask];
+        ids[n] = (long)cqe->user_data;
+        results[n] = cqe->res;
+        n++;
+        head++;
+    }
+    __atomic_store_n(uring_cq_head, head, __ATOMIC_RELEASE);
+    return n;
+}
+
+/**
+ * Tear down the async engine
+ */
+void fs_async_shutdown() {
+    if (uring_fd < 0) return;
+    munmap(uring_sq_ring, uring_sq_ring_size);
+    munmap(uring_cq_ring, uring_cq_ring_size);
+    munmap(uring_sqes, uring_sqes_size);
+    close(uring_fd);
+    uring_fd = -1;
+    uring_sq_ring = uring_cq_ring = NULL;
+    uring_sqes = NULL;
+}
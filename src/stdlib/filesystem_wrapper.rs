@@ -20,6 +20,22 @@ impl FilesystemWrapper {
         let open_fn_type = i64_t.fn_type(&[i8_ptr.into()], false);
         module.add_function("fs_open", open_fn_type, None);
 
+        // fs_open_direct(device: *const i8) -> i32
+        let open_direct_fn_type = i64_t.fn_type(&[i8_ptr.into()], false);
+        module.add_function("fs_open_direct", open_direct_fn_type, None);
+
+        // fs_buf_acquire() -> *mut i8
+        let buf_acquire_fn_type = i8_ptr.fn_type(&[], false);
+        module.add_function("fs_buf_acquire", buf_acquire_fn_type, None);
+
+        // fs_buf_release(buffer: *mut i8) -> void
+        let buf_release_fn_type = context.void_type().fn_type(&[i8_ptr.into()], false);
+        module.add_function("fs_buf_release", buf_release_fn_type, None);
+
+        // fs_buf_size() -> i64
+        let buf_size_fn_type = i64_t.fn_type(&[], false);
+        module.add_function("fs_buf_size", buf_size_fn_type, None);
+
         // fs_close(handle: i32) -> void
         let close_fn_type = context.void_type().fn_type(&[i64_t.into()], false);
         module.add_function("fs_close", close_fn_type, None);
@@ -32,6 +48,82 @@ impl FilesystemWrapper {
         let write_fn_type = i64_t.fn_type(&[i64_t.into(), i64_t.into(), i8_ptr.into()], false);
         module.add_function("fs_write_block", write_fn_type, None);
 
+        // fs_read_blocks(handle: i32, start_block: i64, count: i64, buffer: *mut i8) -> i64
+        let read_blocks_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i64_t.into(), i64_t.into(), i8_ptr.into()], false);
+        module.add_function("fs_read_blocks", read_blocks_fn_type, None);
+
+        // fs_write_blocks(handle: i32, start_block: i64, count: i64, buffer: *const i8) -> i64
+        let write_blocks_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i64_t.into(), i64_t.into(), i8_ptr.into()], false);
+        module.add_function("fs_write_blocks", write_blocks_fn_type, None);
+
+        // fs_readv_blocks(handle: i32, start_block: i64, count: i64, buffers: *mut *mut i8) -> i64
+        let readv_blocks_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i64_t.into(), i64_t.into(), i8_ptr.into()], false);
+        module.add_function("fs_readv_blocks", readv_blocks_fn_type, None);
+
+        // fs_writev_blocks(handle: i32, start_block: i64, count: i64, buffers: *mut *mut i8) -> i64
+        let writev_blocks_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i64_t.into(), i64_t.into(), i8_ptr.into()], false);
+        module.add_function("fs_writev_blocks", writev_blocks_fn_type, None);
+
+        // fs_map(handle: i32, offset: i64, length: i64) -> *mut i8
+        let map_fn_type = i8_ptr.fn_type(&[i64_t.into(), i64_t.into(), i64_t.into()], false);
+        module.add_function("fs_map", map_fn_type, None);
+
+        // fs_unmap(addr: *mut i8, length: i64) -> i64
+        let unmap_fn_type = i64_t.fn_type(&[i8_ptr.into(), i64_t.into()], false);
+        module.add_function("fs_unmap", unmap_fn_type, None);
+
+        // fs_map_advise(addr: *mut i8, length: i64, advice: i64) -> i64
+        let map_advise_fn_type =
+            i64_t.fn_type(&[i8_ptr.into(), i64_t.into(), i64_t.into()], false);
+        module.add_function("fs_map_advise", map_advise_fn_type, None);
+
+        // fs_cache_init(handle: i32, n_blocks: i64) -> i64
+        let cache_init_fn_type = i64_t.fn_type(&[i64_t.into(), i64_t.into()], false);
+        module.add_function("fs_cache_init", cache_init_fn_type, None);
+
+        // fs_cache_set_mode(handle: i32, write_back: i64) -> i64
+        let cache_mode_fn_type = i64_t.fn_type(&[i64_t.into(), i64_t.into()], false);
+        module.add_function("fs_cache_set_mode", cache_mode_fn_type, None);
+
+        // fs_cache_flush(handle: i32) -> i64
+        let cache_flush_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("fs_cache_flush", cache_flush_fn_type, None);
+
+        // fs_cache_get_hits(handle: i32) -> i64
+        let cache_hits_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("fs_cache_get_hits", cache_hits_fn_type, None);
+
+        // fs_cache_get_misses(handle: i32) -> i64
+        let cache_misses_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("fs_cache_get_misses", cache_misses_fn_type, None);
+
+        // fs_async_init(queue_depth: i64) -> i64
+        let async_init_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("fs_async_init", async_init_fn_type, None);
+
+        // fs_submit_read(handle: i32, block_num: i64, buffer: *mut i8) -> i64
+        let submit_read_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i64_t.into(), i8_ptr.into()], false);
+        module.add_function("fs_submit_read", submit_read_fn_type, None);
+
+        // fs_submit_write(handle: i32, block_num: i64, buffer: *const i8) -> i64
+        let submit_write_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i64_t.into(), i8_ptr.into()], false);
+        module.add_function("fs_submit_write", submit_write_fn_type, None);
+
+        // fs_wait_completions(ids: *mut i64, results: *mut i64, max: i64) -> i64
+        let wait_completions_fn_type =
+            i64_t.fn_type(&[i8_ptr.into(), i8_ptr.into(), i64_t.into()], false);
+        module.add_function("fs_wait_completions", wait_completions_fn_type, None);
+
+        // fs_async_shutdown() -> void
+        let async_shutdown_fn_type = context.void_type().fn_type(&[], false);
+        module.add_function("fs_async_shutdown", async_shutdown_fn_type, None);
+
         // fs_get_size(handle: i32) -> i64
         let size_fn_type = i64_t.fn_type(&[i64_t.into()], false);
         module.add_function("fs_get_size", size_fn_type, None);
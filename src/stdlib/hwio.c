@@ -57,6 +57,68 @@ void io_write_port_32(uint16_t port, uint32_t value) {
     asm("outl %0, %1" : : "a" (value), "d" (port));
 }
 
+/**
+ * Read count bytes from an I/O port into buffer with one rep insb
+ * burst, instead of one call per byte
+ */
+void io_read_port_buffer_8(uint16_t port, void* buffer, uint32_t count) {
+    asm volatile("rep insb"
+                 : "+D" (buffer), "+c" (count)
+                 : "d" (port)
+                 : "memory");
+}
+
+/**
+ * Read count 16-bit words from an I/O port (e.g. one ATA PIO sector
+ * is a single call with count = 256)
+ */
+void io_read_port_buffer_16(uint16_t port, void* buffer, uint32_t count) {
+    asm volatile("rep insw"
+                 : "+D" (buffer), "+c" (count)
+                 : "d" (port)
+                 : "memory");
+}
+
+/**
+ * Read count 32-bit dwords from an I/O port
+ */
+void io_read_port_buffer_32(uint16_t port, void* buffer, uint32_t count) {
+    asm volatile("rep insl"
+                 : "+D" (buffer), "+c" (count)
+                 : "d" (port)
+                 : "memory");
+}
+
+/**
+ * Write count bytes from buffer to an I/O port with one rep outsb burst
+ */
+void io_write_port_buffer_8(uint16_t port, const void* buffer, uint32_t count) {
+    asm volatile("rep outsb"
+                 : "+S" (buffer), "+c" (count)
+                 : "d" (port)
+                 : "memory");
+}
+
+/**
+ * Write count 16-bit words from buffer to an I/O port
+ */
+void io_write_port_buffer_16(uint16_t port, const void* buffer, uint32_t count) {
+    asm volatile("rep outsw"
+                 : "+S" (buffer), "+c" (count)
+                 : "d" (port)
+                 : "memory");
+}
+
+/**
+ * Write count 32-bit dwords from buffer to an I/O port
+ */
+void io_write_port_buffer_32(uint16_t port, const void* buffer, uint32_t count) {
+    asm volatile("rep outsl"
+                 : "+S" (buffer), "+c" (count)
+                 : "d" (port)
+                 : "memory");
+}
+
 /**
  * Generic port I/O read (default 32-bit)
  */
@@ -71,6 +133,155 @@ void io_write_port(int port, long value) {
     io_write_port_32((uint16_t)port, (uint32_t)value);
 }
 
+// ---------------------------------------------------------------------------
+// Memory-mapped I/O regions. Modern devices (framebuffers, NVMe, virtio)
+// are MMIO rather than port I/O: map the physical register window once,
+// then poke it through volatile accessors at full bus bandwidth.
+// Hosted builds go through /dev/mem; with -DWHEEL_BARE_METAL the
+// physical address is used directly (identity-mapped environment).
+// ---------------------------------------------------------------------------
+
+#ifndef WHEEL_BARE_METAL
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#define MAX_MMIO_REGIONS 8
+
+typedef struct {
+    volatile void* base;
+    unsigned long size;
+    int in_use;
+} MmioRegion;
+
+static MmioRegion mmio_regions[MAX_MMIO_REGIONS];
+
+/**
+ * Map a physical MMIO window
+ * @param phys_addr: physical base address (page aligned)
+ * @param size: window size in bytes
+ * @return: region handle or -1 on error
+ */
+long io_map_region(long phys_addr, long size) {
+    if (phys_addr < 0 || size <= 0) return -1;
+
+    int slot = -1;
+    for (int i = 0; i < MAX_MMIO_REGIONS; i++) {
+        if (!mmio_regions[i].in_use) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) return -1;
+
+#ifdef WHEEL_BARE_METAL
+    // Identity-mapped: the physical address is the pointer
+    mmio_regions[slot].base = (volatile void*)(unsigned long)phys_addr;
+#else
+    int fd = open("/dev/mem", O_RDWR | O_SYNC);
+    if (fd < 0) return -1;
+
+    void* base = mmap(0, (unsigned long)size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, (off_t)phys_addr);
+    close(fd);  // the mapping keeps the region alive
+    if (base == MAP_FAILED) return -1;
+    mmio_regions[slot].base = (volatile void*)base;
+#endif
+
+    mmio_regions[slot].size = (unsigned long)size;
+    mmio_regions[slot].in_use = 1;
+    return slot;
+}
+
+/**
+ * Unmap an MMIO region
+ * @return: 0 on success or -1 on error
+ */
+long io_unmap_region(long handle) {
+    if (handle < 0 || handle >= MAX_MMIO_REGIONS) return -1;
+    if (!mmio_regions[handle].in_use) return -1;
+
+#ifndef WHEEL_BARE_METAL
+    munmap((void*)mmio_regions[handle].base, mmio_regions[handle].size);
+#endif
+    mmio_regions[handle].in_use = 0;
+    return 0;
+}
+
+// Resolve handle+offset to a register address, NULL if out of bounds
+static volatile void* mmio_addr(long handle, long offset, long width) {
+    if (handle < 0 || handle >= MAX_MMIO_REGIONS) return 0;
+    if (!mmio_regions[handle].in_use) return 0;
+    if (offset < 0 || (unsigned long)(offset + width) > mmio_regions[handle].size) return 0;
+    return (volatile char*)mmio_regions[handle].base + offset;
+}
+
+/**
+ * Volatile 32-bit MMIO register read
+ * @return: register value or -1 on bad handle/offset
+ */
+long io_mmio_read32(long handle, long offset) {
+    volatile uint32_t* reg = (volatile uint32_t*)mmio_addr(handle, offset, 4);
+    if (!reg) return -1;
+    return (long)*reg;
+}
+
+/**
+ * Volatile 32-bit MMIO register write
+ * @return: 0 on success or -1 on bad handle/offset
+ */
+long io_mmio_write32(long handle, long offset, long value) {
+    volatile uint32_t* reg = (volatile uint32_t*)mmio_addr(handle, offset, 4);
+    if (!reg) return -1;
+    *reg = (uint32_t)value;
+    return 0;
+}
+
+/**
+ * Bulk copy out of an MMIO region (32-bit accesses where aligned)
+ * @return: bytes copied or -1 on bad handle/offset
+ */
+long io_mmio_read_buffer(long handle, long offset, void* buffer, long length) {
+    if (buffer == 0 || length <= 0) return -1;
+    volatile char* src = (volatile char*)mmio_addr(handle, offset, length);
+    if (!src) return -1;
+
+    char* dst = (char*)buffer;
+    long i = 0;
+    // Whole registers where alignment allows, bytes at the edges
+    if ((((unsigned long)src | (unsigned long)offset) & 3) == 0) {
+        for (; i + 4 <= length; i += 4) {
+            *(uint32_t*)(dst + i) = *(volatile uint32_t*)(src + i);
+        }
+    }
+    for (; i < length; i++) {
+        dst[i] = src[i];
+    }
+    return length;
+}
+
+/**
+ * Full memory barrier: all loads and stores complete before any after
+ */
+void io_memory_barrier() {
+    asm volatile("mfence" ::: "memory");
+}
+
+/**
+ * Load barrier
+ */
+void io_read_barrier() {
+    asm volatile("lfence" ::: "memory");
+}
+
+/**
+ * Store barrier
+ */
+void io_write_barrier() {
+    asm volatile("sfence" ::: "memory");
+}
+
 /**
  * Enable interrupts
  */
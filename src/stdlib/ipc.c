@@ -0,0 +1,207 @@
+/**
+ * IPC Library for Wheel
+ * Shared-memory channels between Wheel processes: a memfd-backed
+ * mapping with a lock-free ring buffer for variable-size messages,
+ * so parent and children stream data at memory bandwidth instead of
+ * round-tripping through the filesystem.
+ */
+
+#define _GNU_SOURCE  // memfd_create
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define MAX_IPC_CHANNELS 16
+#define IPC_MIN_SIZE 4096
+
+// Ring layout inside the shared mapping. head is advanced by the
+// consumer, tail by the producer; each is written by exactly one side
+// (single-producer/single-consumer), so release/acquire atomics are
+// all the synchronization needed.
+typedef struct {
+    unsigned long capacity;  // data bytes after this header
+    unsigned long head;      // consumer cursor (absolute, not wrapped)
+    unsigned long tail;      // producer cursor (absolute, not wrapped)
+} IpcRing;
+
+typedef struct {
+    int in_use;
+    int fd;
+    IpcRing* ring;
+    size_t map_size;
+} IpcChannel;
+
+static IpcChannel ipc_channels[MAX_IPC_CHANNELS];
+
+static char* ipc_data(IpcRing* ring) {
+    return (char*)(ring + 1);
+}
+
+// Copy into the ring at an absolute position, wrapping at capacity
+static void ring_write(IpcRing* ring, unsigned long pos, const void* src, unsigned long len) {
+    char* data = ipc_data(ring);
+    unsigned long off = pos % ring->capacity;
+    unsigned long first = ring->capacity - off;
+    if (first > len) first = len;
+    memcpy(data + off, src, first);
+    memcpy(data, (const char*)src + first, len - first);
+}
+
+// Copy out of the ring at an absolute position, wrapping at capacity
+static void ring_read(IpcRing* ring, unsigned long pos, void* dst, unsigned long len) {
+    char* data = ipc_data(ring);
+    unsigned long off = pos % ring->capacity;
+    unsigned long first = ring->capacity - off;
+    if (first > len) first = len;
+    memcpy(dst, data + off, first);
+    memcpy((char*)dst + first, data, len - first);
+}
+
+static long ipc_register(int fd, IpcRing* ring, size_t map_size) {
+    for (int i = 0; i < MAX_IPC_CHANNELS; i++) {
+        if (!ipc_channels[i].in_use) {
+            ipc_channels[i].in_use = 1;
+            ipc_channels[i].fd = fd;
+            ipc_channels[i].ring = ring;
+            ipc_channels[i].map_size = map_size;
+            return i;
+        }
+    }
+    return -1;
+}
+
+static IpcChannel* ipc_get(long channel) {
+    if (channel < 0 || channel >= MAX_IPC_CHANNELS) return NULL;
+    if (!ipc_channels[channel].in_use) return NULL;
+    return &ipc_channels[channel];
+}
+
+/**
+ * Create a channel with the given ring capacity in bytes.
+ * The backing fd is inheritable: pass ipc_channel_fd() to a child,
+ * which maps the same memory with ipc_channel_attach.
+ * Returns channel handle or -1 on error
+ */
+long ipc_channel_create(long size) {
+    if (size < IPC_MIN_SIZE) size = IPC_MIN_SIZE;
+    size_t map_size = sizeof(IpcRing) + (size_t)size;
+
+    // No MFD_CLOEXEC: children must inherit the fd across exec
+    int fd = memfd_create("wheel-ipc", 0);
+    if (fd < 0) return -1;
+    if (ftruncate(fd, (off_t)map_size) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    IpcRing* ring = (IpcRing*)mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                                   MAP_SHARED, fd, 0);
+    if (ring == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+
+    ring->capacity = (unsigned long)size;
+    ring->head = 0;
+    ring->tail = 0;
+
+    long handle = ipc_register(fd, ring, map_size);
+    if (handle < 0) {
+        munmap(ring, map_size);
+        close(fd);
+    }
+    return handle;
+}
+
+/**
+ * The channel's backing fd, for handing to a spawned child
+ * (e.g. formatted into its argv)
+ */
+long ipc_channel_fd(long channel) {
+    IpcChannel* c = ipc_get(channel);
+    if (c == NULL) return -1;
+    return c->fd;
+}
+
+/**
+ * Map an existing channel from an inherited fd (child side)
+ * Returns channel handle or -1 on error
+ */
+long ipc_channel_attach(long fd) {
+    struct stat sb;
+    if (fd < 0 || fstat((int)fd, &sb) < 0) return -1;
+    if (sb.st_size < (off_t)(sizeof(IpcRing) + IPC_MIN_SIZE)) return -1;
+
+    size_t map_size = (size_t)sb.st_size;
+    IpcRing* ring = (IpcRing*)mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                                   MAP_SHARED, (int)fd, 0);
+    if (ring == MAP_FAILED) return -1;
+
+    long handle = ipc_register((int)fd, ring, map_size);
+    if (handle < 0) munmap(ring, map_size);
+    return handle;
+}
+
+/**
+ * Send a message (zero syscalls: a memory copy plus a release store).
+ * One process per direction: the ring is single-producer/single-consumer.
+ * @return: 1 sent, 0 ring full (try again after the peer drains), -1 error
+ */
+long ipc_send(long channel, const void* data, long len) {
+    IpcChannel* c = ipc_get(channel);
+    if (c == NULL || data == NULL || len <= 0) return -1;
+
+    IpcRing* ring = c->ring;
+    unsigned long need = sizeof(uint32_t) + (unsigned long)len;
+    if (need > ring->capacity) return -1;  // can never fit
+
+    unsigned long head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    unsigned long tail = ring->tail;
+    if (ring->capacity - (tail - head) < need) return 0;  // full
+
+    uint32_t msg_len = (uint32_t)len;
+    ring_write(ring, tail, &msg_len, sizeof(msg_len));
+    ring_write(ring, tail + sizeof(msg_len), data, (unsigned long)len);
+    __atomic_store_n(&ring->tail, tail + need, __ATOMIC_RELEASE);
+    return 1;
+}
+
+/**
+ * Receive the next message into buffer
+ * @return: message length, 0 if the ring is empty, -1 on error
+ *          (a message longer than max is truncated to max but fully consumed)
+ */
+long ipc_recv(long channel, void* buffer, long max) {
+    IpcChannel* c = ipc_get(channel);
+    if (c == NULL || buffer == NULL || max <= 0) return -1;
+
+    IpcRing* ring = c->ring;
+    unsigned long tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    unsigned long head = ring->head;
+    if (head == tail) return 0;  // empty
+
+    uint32_t msg_len;
+    ring_read(ring, head, &msg_len, sizeof(msg_len));
+
+    unsigned long copy = msg_len;
+    if (copy > (unsigned long)max) copy = (unsigned long)max;
+    ring_read(ring, head + sizeof(msg_len), buffer, copy);
+
+    __atomic_store_n(&ring->head, head + sizeof(msg_len) + msg_len,
+                     __ATOMIC_RELEASE);
+    return (long)copy;
+}
+
+/**
+ * Unmap the channel and close its fd
+ */
+void ipc_channel_close(long channel) {
+    IpcChannel* c = ipc_get(channel);
+    if (c == NULL) return;
+    munmap(c->ring, c->map_size);
+    close(c->fd);
+    c->in_use = 0;
+}
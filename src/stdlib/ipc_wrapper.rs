@@ -0,0 +1,43 @@
+/**
+ * IPC wrapper for LLVM integration
+ */
+
+use inkwell::context::Context;
+use inkwell::module::Module;
+use inkwell::types::IntType;
+
+pub struct IpcWrapper;
+
+impl IpcWrapper {
+    pub fn generate_ipc_functions<'ctx>(
+        context: &'ctx Context,
+        module: &Module<'ctx>,
+    ) {
+        let i64_t = context.i64_type();
+        let i8_ptr = context.i8_type().ptr_type(inkwell::AddressSpace::default());
+
+        // ipc_channel_create(size: i64) -> i64
+        let create_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("ipc_channel_create", create_fn_type, None);
+
+        // ipc_channel_fd(channel: i64) -> i64
+        let fd_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("ipc_channel_fd", fd_fn_type, None);
+
+        // ipc_channel_attach(fd: i64) -> i64
+        let attach_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("ipc_channel_attach", attach_fn_type, None);
+
+        // ipc_send(channel: i64, data: *const i8, len: i64) -> i64
+        let send_fn_type = i64_t.fn_type(&[i64_t.into(), i8_ptr.into(), i64_t.into()], false);
+        module.add_function("ipc_send", send_fn_type, None);
+
+        // ipc_recv(channel: i64, buffer: *mut i8, max: i64) -> i64
+        let recv_fn_type = i64_t.fn_type(&[i64_t.into(), i8_ptr.into(), i64_t.into()], false);
+        module.add_function("ipc_recv", recv_fn_type, None);
+
+        // ipc_channel_close(channel: i64) -> void
+        let close_fn_type = context.void_type().fn_type(&[i64_t.into()], false);
+        module.add_function("ipc_channel_close", close_fn_type, None);
+    }
+}
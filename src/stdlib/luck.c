@@ -1,22 +1,67 @@
 // Luck library: random number generation
-#include <stdlib.h>
+// Engine: xoshiro256** — fast, high quality, and not serialized
+// through libc's internal rand() lock.
+#include <stdint.h>
 #include <time.h>
+#include <unistd.h>
 
-static int _luck_seed_initialized = 0;
+// Per-thread state: every thread gets its own independent stream, so
+// multi-threaded simulations neither contend nor share a sequence
+static __thread uint64_t _luck_state[4];
+static __thread int _luck_seed_initialized = 0;
+
+// splitmix64: expands one seed value into the full xoshiro state
+static uint64_t splitmix64(uint64_t* x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Seed the generator explicitly (per-stream reproducibility)
+void luck_seed(long seed) {
+    uint64_t x = (uint64_t)seed;
+    _luck_state[0] = splitmix64(&x);
+    _luck_state[1] = splitmix64(&x);
+    _luck_state[2] = splitmix64(&x);
+    _luck_state[3] = splitmix64(&x);
+    _luck_seed_initialized = 1;
+}
 
 // Initialize random seed (called once)
 void luck_init(void) {
     if (!_luck_seed_initialized) {
-        srand((unsigned int)time(NULL));
-        _luck_seed_initialized = 1;
+        // Mix in the state's address so each thread's stream differs
+        luck_seed((long)(time(NULL) ^ ((uint64_t)getpid() << 32)
+                         ^ (uint64_t)(uintptr_t)_luck_state));
     }
 }
 
+static inline uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// One xoshiro256** step
+static uint64_t luck_next(void) {
+    uint64_t* s = _luck_state;
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+
+    return result;
+}
+
 // Generate random number between 0 and max (inclusive)
 long luck_random(long max) {
     luck_init();
     if (max <= 0) return 0;
-    return (long)(rand() % (max + 1));
+    return (long)(luck_next() % ((uint64_t)max + 1));
 }
 
 // Generate random number between min and max (inclusive)
@@ -28,5 +73,37 @@ long luck_random_range(long min, long max) {
         max = tmp;
     }
     if (min == max) return min;
-    return min + (long)(rand() % (max - min + 1));
+    return min + (long)(luck_next() % ((uint64_t)(max - min) + 1));
+}
+
+// Uniform random number in [min, max] with rejection sampling, so no
+// modulo bias even when the span doesn't divide 2^64
+long luck_random_unbiased(long min, long max) {
+    luck_init();
+    if (min > max) {
+        long tmp = min;
+        min = max;
+        max = tmp;
+    }
+    uint64_t span = (uint64_t)(max - min) + 1;
+    if (span == 0) return (long)luck_next();  // full 64-bit range
+
+    // Reject draws from the tail that doesn't divide evenly
+    uint64_t limit = UINT64_MAX - (UINT64_MAX % span + 1) % span;
+    uint64_t draw;
+    do {
+        draw = luck_next();
+    } while (draw > limit);
+    return min + (long)(draw % span);
+}
+
+// Fill a buffer with count random numbers in [0, max] in one call,
+// keeping the generator state hot instead of paying a call per value
+void luck_fill(long* buffer, long count, long max) {
+    luck_init();
+    if (buffer == 0 || count <= 0 || max < 0) return;
+    uint64_t span = (uint64_t)max + 1;
+    for (long i = 0; i < count; i++) {
+        buffer[i] = (long)(luck_next() % span);
+    }
 }
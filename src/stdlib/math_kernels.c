@@ -0,0 +1,127 @@
+/**
+ * Array math kernels for Wheel
+ * Whole-buffer operations over contiguous f64/i64 arrays, so a
+ * million-element reduction is one FFI call instead of a million
+ * generated-code iterations. Each kernel is cloned for AVX2 and SSE
+ * with a scalar fallback; the loader picks the best variant for the
+ * running CPU.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__x86_64__)
+#define WHEEL_SIMD __attribute__((target_clones("avx2", "sse2", "default")))
+#else
+#define WHEEL_SIMD
+#endif
+
+// ----- f64 kernels ---------------------------------------------------------
+
+/** out[i] = a[i] + b[i] */
+WHEEL_SIMD
+void math_vec_add_f64(const double* restrict a, const double* restrict b,
+                      double* restrict out, long n) {
+    for (long i = 0; i < n; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+/** out[i] = a[i] * b[i] */
+WHEEL_SIMD
+void math_vec_mul_f64(const double* restrict a, const double* restrict b,
+                      double* restrict out, long n) {
+    for (long i = 0; i < n; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+/** Dot product of a and b */
+WHEEL_SIMD
+double math_vec_dot_f64(const double* restrict a, const double* restrict b, long n) {
+    double acc = 0.0;
+    for (long i = 0; i < n; i++) {
+        acc += a[i] * b[i];
+    }
+    return acc;
+}
+
+/** Sum of all elements */
+WHEEL_SIMD
+double math_vec_sum_f64(const double* restrict a, long n) {
+    double acc = 0.0;
+    for (long i = 0; i < n; i++) {
+        acc += a[i];
+    }
+    return acc;
+}
+
+/** Minimum and maximum in one pass */
+WHEEL_SIMD
+void math_vec_min_max_f64(const double* restrict a, long n,
+                          double* restrict min_out, double* restrict max_out) {
+    if (n <= 0) return;
+    double lo = a[0];
+    double hi = a[0];
+    for (long i = 1; i < n; i++) {
+        if (a[i] < lo) lo = a[i];
+        if (a[i] > hi) hi = a[i];
+    }
+    if (min_out) *min_out = lo;
+    if (max_out) *max_out = hi;
+}
+
+// ----- i64 kernels ---------------------------------------------------------
+
+/** out[i] = a[i] + b[i] */
+WHEEL_SIMD
+void math_vec_add_i64(const int64_t* restrict a, const int64_t* restrict b,
+                      int64_t* restrict out, long n) {
+    for (long i = 0; i < n; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+/** out[i] = a[i] * b[i] */
+WHEEL_SIMD
+void math_vec_mul_i64(const int64_t* restrict a, const int64_t* restrict b,
+                      int64_t* restrict out, long n) {
+    for (long i = 0; i < n; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+/** Dot product of a and b */
+WHEEL_SIMD
+int64_t math_vec_dot_i64(const int64_t* restrict a, const int64_t* restrict b, long n) {
+    int64_t acc = 0;
+    for (long i = 0; i < n; i++) {
+        acc += a[i] * b[i];
+    }
+    return acc;
+}
+
+/** Sum of all elements */
+WHEEL_SIMD
+int64_t math_vec_sum_i64(const int64_t* restrict a, long n) {
+    int64_t acc = 0;
+    for (long i = 0; i < n; i++) {
+        acc += a[i];
+    }
+    return acc;
+}
+
+/** Minimum and maximum in one pass */
+WHEEL_SIMD
+void math_vec_min_max_i64(const int64_t* restrict a, long n,
+                          int64_t* restrict min_out, int64_t* restrict max_out) {
+    if (n <= 0) return;
+    int64_t lo = a[0];
+    int64_t hi = a[0];
+    for (long i = 1; i < n; i++) {
+        if (a[i] < lo) lo = a[i];
+        if (a[i] > hi) hi = a[i];
+    }
+    if (min_out) *min_out = lo;
+    if (max_out) *max_out = hi;
+}
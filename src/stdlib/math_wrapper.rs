@@ -112,3 +112,66 @@ pub mod math {
     pub const E: f64 = std::f64::consts::E;
     pub const TAU: f64 = std::f64::consts::TAU;
 }
+
+/// Declarations for the SIMD array kernels in math_kernels.c, in the
+/// same style as the other library wrappers
+pub struct MathKernelsWrapper;
+
+impl MathKernelsWrapper {
+    pub fn generate_math_kernel_functions<'ctx>(
+        context: &'ctx inkwell::context::Context,
+        module: &inkwell::module::Module<'ctx>,
+    ) {
+        let i64_t = context.i64_type();
+        let f64_t = context.f64_type();
+        let void_t = context.void_type();
+        let f64_ptr = f64_t.ptr_type(inkwell::AddressSpace::default());
+        let i64_ptr = i64_t.ptr_type(inkwell::AddressSpace::default());
+
+        // math_vec_add_f64 / math_vec_mul_f64(a, b, out, n) -> void
+        let binop_f64 = void_t.fn_type(
+            &[f64_ptr.into(), f64_ptr.into(), f64_ptr.into(), i64_t.into()],
+            false,
+        );
+        module.add_function("math_vec_add_f64", binop_f64, None);
+        module.add_function("math_vec_mul_f64", binop_f64, None);
+
+        // math_vec_dot_f64(a, b, n) -> f64
+        let dot_f64 = f64_t.fn_type(&[f64_ptr.into(), f64_ptr.into(), i64_t.into()], false);
+        module.add_function("math_vec_dot_f64", dot_f64, None);
+
+        // math_vec_sum_f64(a, n) -> f64
+        let sum_f64 = f64_t.fn_type(&[f64_ptr.into(), i64_t.into()], false);
+        module.add_function("math_vec_sum_f64", sum_f64, None);
+
+        // math_vec_min_max_f64(a, n, min_out, max_out) -> void
+        let minmax_f64 = void_t.fn_type(
+            &[f64_ptr.into(), i64_t.into(), f64_ptr.into(), f64_ptr.into()],
+            false,
+        );
+        module.add_function("math_vec_min_max_f64", minmax_f64, None);
+
+        // math_vec_add_i64 / math_vec_mul_i64(a, b, out, n) -> void
+        let binop_i64 = void_t.fn_type(
+            &[i64_ptr.into(), i64_ptr.into(), i64_ptr.into(), i64_t.into()],
+            false,
+        );
+        module.add_function("math_vec_add_i64", binop_i64, None);
+        module.add_function("math_vec_mul_i64", binop_i64, None);
+
+        // math_vec_dot_i64(a, b, n) -> i64
+        let dot_i64 = i64_t.fn_type(&[i64_ptr.into(), i64_ptr.into(), i64_t.into()], false);
+        module.add_function("math_vec_dot_i64", dot_i64, None);
+
+        // math_vec_sum_i64(a, n) -> i64
+        let sum_i64 = i64_t.fn_type(&[i64_ptr.into(), i64_t.into()], false);
+        module.add_function("math_vec_sum_i64", sum_i64, None);
+
+        // math_vec_min_max_i64(a, n, min_out, max_out) -> void
+        let minmax_i64 = void_t.fn_type(
+            &[i64_ptr.into(), i64_t.into(), i64_ptr.into(), i64_ptr.into()],
+            false,
+        );
+        module.add_function("math_vec_min_max_i64", minmax_i64, None);
+    }
+}
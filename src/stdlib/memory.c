@@ -1,98 +1,701 @@
 /**
  * Memory Management Library for Wheel
- * Simple heap allocator with malloc/free
+ * Segregated free-list heap allocator with malloc/free/realloc.
+ * Small allocations go through per-thread caches; the shared heap
+ * behind them is protected by a spinlock. Free blocks carry boundary
+ * tags so adjacent blocks coalesce in both directions.
  */
 
 #include <stddef.h>
 #include <string.h>
+#include <sys/mman.h>
 
-#define HEAP_SIZE 1024 * 1024  // 1MB heap
+#include "wheel_stats.h"
+
+#define HEAP_INITIAL_CHUNK (64 * 1024)       // first mmap'd chunk: 64KB
+#define HEAP_MAX_CHUNK (16 * 1024 * 1024)    // chunk growth caps at 16MB
 #define MIN_BLOCK_SIZE 32
 
+// Size classes for the segregated free lists: 32, 64, ... 4096.
+// Anything larger goes on the large-block list.
+#define NUM_SIZE_CLASSES 8
+#define MAX_SMALL_SIZE 4096
+
+// Per-thread cache tuning: how many blocks a refill grabs from the
+// central heap, and how many a thread may hoard before flushing back
+#define TCACHE_FILL 8
+#define TCACHE_MAX 64
+
+// Block states
+#define BLOCK_USED 0
+#define BLOCK_FREE 1    // on a central free list, coalescable
+#define BLOCK_CACHED 2  // parked in a thread cache
+
+struct HeapChunk;
+
 typedef struct MemBlock {
     size_t size;
-    int is_free;
-    struct MemBlock* next;
+    int is_free;               // BLOCK_USED / BLOCK_FREE / BLOCK_CACHED
+    int prev_free;             // physical predecessor is BLOCK_FREE
+    struct HeapChunk* chunk;   // owning chunk, for neighbor bounds
+    struct MemBlock* next;     // free-list links while the block is free
+    struct MemBlock* prev;
 } MemBlock;
 
-static char heap[HEAP_SIZE];
-static MemBlock* heap_start = NULL;
-static size_t heap_used = 0;
+// The heap is a chain of mmap'd chunks; each chunk is tiled with blocks
+// from its data area up to chunk->used
+typedef struct HeapChunk {
+    struct HeapChunk* next;
+    size_t size;  // usable bytes after this header
+    size_t used;  // bytes tiled with blocks so far
+} HeapChunk;
+
+static HeapChunk* chunk_list = NULL;           // all mapped chunks
+static HeapChunk* cur_chunk = NULL;            // chunk owning the wilderness
+static MemBlock* free_bins[NUM_SIZE_CLASSES];  // per-class free lists
+static MemBlock* large_bin = NULL;             // blocks > MAX_SMALL_SIZE
+static size_t next_chunk_size = HEAP_INITIAL_CHUNK;
+static size_t total_mapped = 0;
+static size_t heap_limit = 0;                  // 0 = unlimited
+static int heap_initialized = 0;
+
+// Running statistics, maintained with relaxed atomics so the unlocked
+// per-thread fast paths can update them too
+static size_t stat_alloc_count = 0;
+static size_t stat_free_count = 0;
+static size_t stat_bytes_used = 0;   // live blocks, headers included
+static size_t stat_peak_used = 0;
+static size_t stat_total_usable = 0; // sum of chunk data areas
+
+static void stat_note_alloc(size_t block_size) {
+    size_t total = sizeof(MemBlock) + block_size;
+    wheel_stat_add(WHEEL_STAT_MEM_ALLOCS, 1);
+    wheel_stat_add(WHEEL_STAT_MEM_BYTES, total);
+    __atomic_add_fetch(&stat_alloc_count, 1, __ATOMIC_RELAXED);
+    size_t used = __atomic_add_fetch(&stat_bytes_used, total, __ATOMIC_RELAXED);
+    size_t peak = __atomic_load_n(&stat_peak_used, __ATOMIC_RELAXED);
+    while (used > peak &&
+           !__atomic_compare_exchange_n(&stat_peak_used, &peak, used, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        // another thread raced us; retry with its peak
+    }
+}
+
+static void stat_note_free(size_t block_size) {
+    wheel_stat_add(WHEEL_STAT_MEM_FREES, 1);
+    __atomic_add_fetch(&stat_free_count, 1, __ATOMIC_RELAXED);
+    __atomic_sub_fetch(&stat_bytes_used, sizeof(MemBlock) + block_size, __ATOMIC_RELAXED);
+}
+
+// Spinlock guarding all central heap state above
+static volatile int heap_lock = 0;
+
+static void heap_lock_acquire() {
+    while (__atomic_exchange_n(&heap_lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(&heap_lock, __ATOMIC_RELAXED)) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+    }
+}
+
+static void heap_lock_release() {
+    __atomic_store_n(&heap_lock, 0, __ATOMIC_RELEASE);
+}
+
+// Per-thread caches of free small blocks, one list per size class;
+// hits here touch no shared state at all
+static __thread MemBlock* tcache_bins[NUM_SIZE_CLASSES];
+static __thread int tcache_counts[NUM_SIZE_CLASSES];
+
+// Map a fresh chunk big enough for at least `need` usable bytes
+static HeapChunk* chunk_map(size_t need) {
+    size_t csize = next_chunk_size;
+    while (csize < need + sizeof(HeapChunk)) {
+        if (csize >= HEAP_MAX_CHUNK) {
+            csize = need + sizeof(HeapChunk);
+            break;
+        }
+        csize *= 2;
+    }
+    csize = (csize + 4095) & ~(size_t)4095;  // round up to page size
+
+    if (heap_limit != 0 && total_mapped + csize > heap_limit) return NULL;
+
+    void* mem = mmap(NULL, csize, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) return NULL;
+
+    HeapChunk* chunk = (HeapChunk*)mem;
+    chunk->size = csize - sizeof(HeapChunk);
+    chunk->used = 0;
+    chunk->next = chunk_list;
+    chunk_list = chunk;
+    total_mapped += csize;
+    __atomic_add_fetch(&stat_total_usable, chunk->size, __ATOMIC_RELAXED);
+
+    if (next_chunk_size < HEAP_MAX_CHUNK) next_chunk_size *= 2;
+    return chunk;
+}
+
+static const size_t class_sizes[NUM_SIZE_CLASSES] = {
+    32, 64, 128, 256, 512, 1024, 2048, 4096
+};
+
+// Must be called with the heap lock held
+static void heap_init_locked() {
+    if (!heap_initialized) {
+        for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+            free_bins[i] = NULL;
+        }
+        large_bin = NULL;
+        cur_chunk = chunk_map(0);
+        heap_initialized = 1;
+    }
+}
 
 void mem_init() {
-    if (heap_start == NULL) {
-        heap_start = (MemBlock*)heap;
-        heap_start->size = HEAP_SIZE - sizeof(MemBlock);
-        heap_start->is_free = 1;
-        heap_start->next = NULL;
-        heap_used = sizeof(MemBlock);
+    heap_lock_acquire();
+    heap_init_locked();
+    heap_lock_release();
+}
+
+/**
+ * Cap the total heap size in bytes (0 = unlimited).
+ * Existing mappings are untouched; growth beyond the limit fails.
+ */
+void mem_set_limit(size_t bytes) {
+    heap_limit = bytes;
+}
+
+// Smallest class that can satisfy a request of this size
+static int bin_for_request(size_t size) {
+    for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+        if (class_sizes[i] >= size) return i;
+    }
+    return -1;  // large request
+}
+
+// Largest class whose size fits in a free block of this size
+static int bin_for_block(size_t size) {
+    for (int i = NUM_SIZE_CLASSES - 1; i >= 0; i--) {
+        if (class_sizes[i] <= size) return i;
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// Boundary tags. A BLOCK_FREE block stores its size in the last 8 bytes
+// of its payload (the footer), and its physical successor has prev_free
+// set, so mem_free can find and merge the predecessor without a scan.
+// The footer is only ever read when prev_free says it is valid; once a
+// block is handed out the payload may overwrite it freely.
+// ---------------------------------------------------------------------------
+
+// Physical successor within the tiled area of the same chunk, or NULL
+static MemBlock* phys_next(MemBlock* block) {
+    char* data = (char*)(block->chunk + 1);
+    char* next = (char*)block + sizeof(MemBlock) + block->size;
+    if (next < data + block->chunk->used) return (MemBlock*)next;
+    return NULL;
+}
+
+// Mark a block free: write its footer and flag its successor
+static void mark_free(MemBlock* block) {
+    block->is_free = BLOCK_FREE;
+    *(size_t*)((char*)block + sizeof(MemBlock) + block->size - sizeof(size_t)) =
+        block->size;
+    MemBlock* next = phys_next(block);
+    if (next != NULL) next->prev_free = 1;
+}
+
+// Mark a block used: its footer becomes payload, successor unflagged
+static void mark_used(MemBlock* block) {
+    block->is_free = BLOCK_USED;
+    MemBlock* next = phys_next(block);
+    if (next != NULL) next->prev_free = 0;
+}
+
+// Push a free block onto the (doubly linked) list for its size
+static void bin_push(MemBlock* block) {
+    MemBlock** head;
+    if (block->size > MAX_SMALL_SIZE) {
+        head = &large_bin;
+    } else {
+        head = &free_bins[bin_for_block(block->size)];
+    }
+    block->next = *head;
+    block->prev = NULL;
+    if (*head != NULL) (*head)->prev = block;
+    *head = block;
+}
+
+// Unlink a free block from whichever list it is on
+static void bin_remove(MemBlock* block) {
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else if (large_bin == block) {
+        large_bin = block->next;
+    } else {
+        free_bins[bin_for_block(block->size)] = block->next;
+    }
+    if (block->next != NULL) block->next->prev = block->prev;
+}
+
+// Merge a block with any BLOCK_FREE physical neighbors on both sides,
+// returning the (possibly relocated) merged block. Lock must be held.
+static MemBlock* coalesce(MemBlock* block) {
+    MemBlock* next = phys_next(block);
+    while (next != NULL && next->is_free == BLOCK_FREE) {
+        bin_remove(next);
+        block->size += sizeof(MemBlock) + next->size;
+        next = phys_next(block);
+    }
+    while (block->prev_free) {
+        size_t psize = *((size_t*)block - 1);
+        MemBlock* pred = (MemBlock*)((char*)block - sizeof(MemBlock) - psize);
+        bin_remove(pred);
+        pred->size += sizeof(MemBlock) + block->size;
+        block = pred;
+    }
+    return block;
+}
+
+// Return a block to the central free lists, coalescing with neighbors.
+// Lock must be held.
+static void central_free_block(MemBlock* block) {
+    block = coalesce(block);
+    mark_free(block);
+    bin_push(block);
+}
+
+// Split the tail off a block if it's big enough to stand alone,
+// and return the remainder to the free lists
+static void split_block(MemBlock* block, size_t size) {
+    if (block->size > size + sizeof(MemBlock) + MIN_BLOCK_SIZE) {
+        MemBlock* remainder = (MemBlock*)((char*)block + sizeof(MemBlock) + size);
+        remainder->size = block->size - size - sizeof(MemBlock);
+        remainder->chunk = block->chunk;
+        remainder->prev_free = 0;  // the block in front is being handed out
+        block->size = size;
+        mark_free(remainder);
+        bin_push(remainder);
+    }
+}
+
+// Carve a fresh block from the wilderness area of the current chunk,
+// mapping a new chunk when it runs out
+static MemBlock* wilderness_alloc(size_t size) {
+    size_t total = sizeof(MemBlock) + size;
+
+    if (cur_chunk == NULL || cur_chunk->used + total > cur_chunk->size) {
+        // Retire the remainder of the old chunk as a free block so no
+        // mapped memory is stranded
+        if (cur_chunk != NULL) {
+            size_t left = cur_chunk->size - cur_chunk->used;
+            if (left >= sizeof(MemBlock) + MIN_BLOCK_SIZE) {
+                MemBlock* tail = (MemBlock*)((char*)(cur_chunk + 1) + cur_chunk->used);
+                tail->size = left - sizeof(MemBlock);
+                tail->chunk = cur_chunk;
+                tail->prev_free = 0;
+                cur_chunk->used = cur_chunk->size;
+                central_free_block(tail);
+            } else {
+                cur_chunk->used = cur_chunk->size;
+            }
+        }
+
+        HeapChunk* chunk = chunk_map(total);
+        if (chunk == NULL) return NULL;
+        cur_chunk = chunk;
+    }
+
+    MemBlock* block = (MemBlock*)((char*)(cur_chunk + 1) + cur_chunk->used);
+    block->size = size;
+    block->chunk = cur_chunk;
+    // Conservative: a fresh carve never merges backward, even if the
+    // block physically before it happens to be free
+    block->prev_free = 0;
+    cur_chunk->used += total;
+    return block;
+}
+
+// Grab one free block of the given class from the central heap.
+// Must be called with the heap lock held.
+static MemBlock* central_alloc_small(int bin) {
+    size_t csize = class_sizes[bin];
+
+    if (free_bins[bin] != NULL) {
+        MemBlock* block = free_bins[bin];
+        free_bins[bin] = block->next;
+        if (block->next != NULL) block->next->prev = NULL;
+        mark_used(block);
+        return block;
+    }
+
+    MemBlock* block = wilderness_alloc(csize);
+    if (block != NULL) {
+        mark_used(block);
+        return block;
+    }
+
+    // Wilderness exhausted: steal from a larger bin and split
+    for (int i = bin + 1; i < NUM_SIZE_CLASSES; i++) {
+        if (free_bins[i] != NULL) {
+            MemBlock* victim = free_bins[i];
+            free_bins[i] = victim->next;
+            if (victim->next != NULL) victim->next->prev = NULL;
+            split_block(victim, csize);
+            mark_used(victim);
+            return victim;
+        }
+    }
+
+    // Last resort: the large-block list
+    for (MemBlock* current = large_bin; current != NULL; current = current->next) {
+        if (current->size >= csize) {
+            bin_remove(current);
+            split_block(current, csize);
+            mark_used(current);
+            return current;
+        }
     }
+
+    return NULL;
 }
 
 void* mem_alloc(size_t size) {
-    mem_init();
-    
     if (size == 0) return NULL;
-    
-    // Find first free block
-    MemBlock* current = heap_start;
-    while (current != NULL) {
-        if (current->is_free && current->size >= size) {
-            // Split block if it's larger than needed
-            if (current->size > size + sizeof(MemBlock) + MIN_BLOCK_SIZE) {
-                MemBlock* new_block = (MemBlock*)((char*)current + sizeof(MemBlock) + size);
-                new_block->size = current->size - size - sizeof(MemBlock);
-                new_block->is_free = 1;
-                new_block->next = current->next;
-                
-                current->size = size;
-                current->next = new_block;
+    if (size > ((size_t)-1) / 2) return NULL;  // reject sizes that would overflow
+    if (size < MIN_BLOCK_SIZE) size = MIN_BLOCK_SIZE;
+    size = (size + 7) & ~(size_t)7;  // keep block layout 8-byte aligned
+
+    int bin = bin_for_request(size);
+
+    if (bin >= 0) {
+        // Fast path: pop from this thread's cache, no shared state touched
+        MemBlock* block = tcache_bins[bin];
+        if (block != NULL) {
+            tcache_bins[bin] = block->next;
+            tcache_counts[bin]--;
+            block->is_free = BLOCK_USED;
+            block->next = NULL;
+            stat_note_alloc(block->size);
+            return (void*)((char*)block + sizeof(MemBlock));
+        }
+
+        // Cache miss: refill a batch from the central heap in one
+        // lock acquisition, keep the first block for this request
+        heap_lock_acquire();
+        heap_init_locked();
+        block = central_alloc_small(bin);
+        if (block != NULL) {
+            for (int n = 1; n < TCACHE_FILL; n++) {
+                MemBlock* extra = central_alloc_small(bin);
+                if (extra == NULL) break;
+                extra->is_free = BLOCK_CACHED;
+                extra->next = tcache_bins[bin];
+                tcache_bins[bin] = extra;
+                tcache_counts[bin]++;
             }
-            
-            current->is_free = 0;
+        }
+        heap_lock_release();
+
+        if (block != NULL) {
+            block->next = NULL;
+            stat_note_alloc(block->size);
+            return (void*)((char*)block + sizeof(MemBlock));
+        }
+        return NULL;  // Not enough memory
+    }
+
+    // Large request: first-fit scan of the large-block list, then the
+    // wilderness, all under the central lock
+    heap_lock_acquire();
+    heap_init_locked();
+
+    for (MemBlock* current = large_bin; current != NULL; current = current->next) {
+        if (current->size >= size) {
+            bin_remove(current);
+            split_block(current, size);
+            mark_used(current);
+            current->next = NULL;
+            heap_lock_release();
+            stat_note_alloc(current->size);
             return (void*)((char*)current + sizeof(MemBlock));
         }
-        current = current->next;
     }
-    
+
+    MemBlock* block = wilderness_alloc(size);
+    if (block != NULL) {
+        mark_used(block);
+        block->next = NULL;
+        heap_lock_release();
+        stat_note_alloc(block->size);
+        return (void*)((char*)block + sizeof(MemBlock));
+    }
+
+    heap_lock_release();
     return NULL;  // Not enough memory
 }
 
 void mem_free(void* ptr) {
     if (ptr == NULL) return;
-    
+
     MemBlock* block = (MemBlock*)((char*)ptr - sizeof(MemBlock));
-    block->is_free = 1;
-    
-    // Merge with next block if it's free
-    if (block->next != NULL && block->next->is_free) {
-        block->size += sizeof(MemBlock) + block->next->size;
-        block->next = block->next->next;
+    stat_note_free(block->size);
+
+    if (block->size <= MAX_SMALL_SIZE) {
+        // Fast path: push onto this thread's cache
+        int bin = bin_for_block(block->size);
+        block->is_free = BLOCK_CACHED;
+        block->next = tcache_bins[bin];
+        tcache_bins[bin] = block;
+        tcache_counts[bin]++;
+
+        // Cache overfull: flush half back to the central heap so one
+        // thread can't hoard the whole heap
+        if (tcache_counts[bin] >= TCACHE_MAX) {
+            heap_lock_acquire();
+            for (int n = 0; n < TCACHE_MAX / 2; n++) {
+                MemBlock* flushed = tcache_bins[bin];
+                tcache_bins[bin] = flushed->next;
+                tcache_counts[bin]--;
+                central_free_block(flushed);
+            }
+            heap_lock_release();
+        }
+        return;
     }
+
+    heap_lock_acquire();
+    central_free_block(block);
+    heap_lock_release();
 }
 
-size_t mem_get_used() {
-    size_t used = 0;
-    MemBlock* current = heap_start;
-    while (current != NULL) {
-        if (!current->is_free) {
-            used += sizeof(MemBlock) + current->size;
+/**
+ * Resize an allocation, growing in place when the physically following
+ * block is free so string/array growth stops paying alloc+copy+free.
+ */
+void* mem_realloc(void* ptr, size_t size) {
+    if (ptr == NULL) return mem_alloc(size);
+    if (size == 0) {
+        mem_free(ptr);
+        return NULL;
+    }
+    if (size > ((size_t)-1) / 2) return NULL;
+    if (size < MIN_BLOCK_SIZE) size = MIN_BLOCK_SIZE;
+    size = (size + 7) & ~(size_t)7;
+
+    MemBlock* block = (MemBlock*)((char*)ptr - sizeof(MemBlock));
+
+    // Shrinking (or already big enough): keep the block as is
+    if (block->size >= size) return ptr;
+
+    // Try to absorb free physical successors instead of moving
+    heap_lock_acquire();
+    size_t grown = block->size;
+    MemBlock* next = phys_next(block);
+    while (next != NULL && next->is_free == BLOCK_FREE &&
+           grown < size) {
+        grown += sizeof(MemBlock) + next->size;
+        next = phys_next(next);
+    }
+    if (grown >= size) {
+        size_t old_size = block->size;
+        next = phys_next(block);
+        while (block->size < size) {
+            bin_remove(next);
+            block->size += sizeof(MemBlock) + next->size;
+            next = phys_next(block);
         }
-        current = current->next;
+        split_block(block, size > block->size ? block->size : size);
+        mark_used(block);
+        heap_lock_release();
+        __atomic_add_fetch(&stat_bytes_used, block->size - old_size, __ATOMIC_RELAXED);
+        return ptr;
     }
-    return used;
+    heap_lock_release();
+
+    // No luck: allocate, copy, free
+    void* fresh = mem_alloc(size);
+    if (fresh == NULL) return NULL;
+    memcpy(fresh, ptr, block->size);
+    mem_free(ptr);
+    return fresh;
+}
+
+size_t mem_get_used() {
+    return __atomic_load_n(&stat_bytes_used, __ATOMIC_RELAXED);
 }
 
 size_t mem_get_free() {
-    size_t free = 0;
-    MemBlock* current = heap_start;
-    while (current != NULL) {
-        if (current->is_free) {
-            free += sizeof(MemBlock) + current->size;
+    size_t usable = __atomic_load_n(&stat_total_usable, __ATOMIC_RELAXED);
+    size_t used = __atomic_load_n(&stat_bytes_used, __ATOMIC_RELAXED);
+    return (used < usable) ? usable - used : 0;
+}
+
+/**
+ * Snapshot of allocator health, cheap enough to scrape every second.
+ * The counters are O(1) reads; only largest_free_block walks the free
+ * lists (under the lock).
+ */
+typedef struct MemStats {
+    size_t alloc_count;         // total successful mem_allocs
+    size_t free_count;          // total mem_frees
+    size_t current_used;        // live bytes, headers included
+    size_t peak_used;           // high-water mark of current_used
+    size_t total_mapped;        // bytes mmap'd from the OS
+    size_t largest_free_block;  // biggest single free block
+    size_t fragmentation_pct;   // 100 - largest_free*100/total_free
+} MemStats;
+
+void mem_get_stats(MemStats* out) {
+    if (out == NULL) return;
+
+    out->alloc_count = __atomic_load_n(&stat_alloc_count, __ATOMIC_RELAXED);
+    out->free_count = __atomic_load_n(&stat_free_count, __ATOMIC_RELAXED);
+    out->current_used = __atomic_load_n(&stat_bytes_used, __ATOMIC_RELAXED);
+    out->peak_used = __atomic_load_n(&stat_peak_used, __ATOMIC_RELAXED);
+
+    heap_lock_acquire();
+    out->total_mapped = total_mapped;
+
+    size_t largest = 0;
+    for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+        for (MemBlock* b = free_bins[i]; b != NULL; b = b->next) {
+            if (b->size > largest) largest = b->size;
         }
-        current = current->next;
     }
-    return free;
+    for (MemBlock* b = large_bin; b != NULL; b = b->next) {
+        if (b->size > largest) largest = b->size;
+    }
+    // The wilderness is the biggest contiguous run when nothing on the
+    // free lists beats it
+    if (cur_chunk != NULL && cur_chunk->size - cur_chunk->used > largest) {
+        largest = cur_chunk->size - cur_chunk->used;
+    }
+    heap_lock_release();
+
+    out->largest_free_block = largest;
+    size_t total_free = mem_get_free();
+    out->fragmentation_pct =
+        (total_free > 0) ? 100 - (largest * 100) / total_free : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Arena allocator: pointer-bump allocation with bulk free, layered on the
+// heap above. Made for request-style workloads that allocate thousands of
+// short-lived objects and drop them all at once.
+// ---------------------------------------------------------------------------
+
+#define ARENA_MIN_CHUNK 1024
+#define ARENA_MAX_CHUNK (1024 * 1024)  // chunk growth caps at 1MB
+
+typedef struct ArenaChunk {
+    struct ArenaChunk* next;
+    size_t size;  // usable bytes after this header
+    size_t used;
+} ArenaChunk;
+
+typedef struct MemArena {
+    ArenaChunk* first;
+    ArenaChunk* current;
+    size_t next_chunk_size;  // doubles as the arena grows
+} MemArena;
+
+static ArenaChunk* arena_chunk_new(size_t size) {
+    ArenaChunk* chunk = (ArenaChunk*)mem_alloc(sizeof(ArenaChunk) + size);
+    if (chunk == NULL) return NULL;
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+    return chunk;
+}
+
+/**
+ * Create an arena with the given initial capacity in bytes.
+ * Returns an arena handle or NULL on error.
+ */
+void* mem_arena_create(size_t initial_size) {
+    if (initial_size < ARENA_MIN_CHUNK) initial_size = ARENA_MIN_CHUNK;
+
+    MemArena* arena = (MemArena*)mem_alloc(sizeof(MemArena));
+    if (arena == NULL) return NULL;
+
+    arena->first = arena_chunk_new(initial_size);
+    if (arena->first == NULL) {
+        mem_free(arena);
+        return NULL;
+    }
+    arena->current = arena->first;
+    arena->next_chunk_size = initial_size * 2;
+    return (void*)arena;
+}
+
+/**
+ * Allocate from an arena: a pointer bump in the common case.
+ * Memory is only reclaimed by mem_arena_reset/mem_arena_destroy.
+ */
+void* mem_arena_alloc(void* arena_ptr, size_t size) {
+    MemArena* arena = (MemArena*)arena_ptr;
+    if (arena == NULL || size == 0) return NULL;
+    if (size > ((size_t)-1) / 2) return NULL;  // reject sizes that would overflow
+    size = (size + 7) & ~(size_t)7;  // keep returned pointers 8-byte aligned
+
+    ArenaChunk* chunk = arena->current;
+    if (chunk->used + size > chunk->size) {
+        // Current chunk full: grab a bigger one from the heap
+        size_t csize = arena->next_chunk_size;
+        if (csize < size) csize = size;
+        ArenaChunk* fresh = arena_chunk_new(csize);
+        if (fresh == NULL) return NULL;
+        if (arena->next_chunk_size < ARENA_MAX_CHUNK) arena->next_chunk_size *= 2;
+
+        chunk->next = fresh;
+        arena->current = fresh;
+        chunk = fresh;
+    }
+
+    void* ptr = (char*)(chunk + 1) + chunk->used;
+    chunk->used += size;
+    return ptr;
+}
+
+/**
+ * Free everything the arena handed out in one shot.
+ * The first chunk is kept so the next request reuses warm memory.
+ */
+void mem_arena_reset(void* arena_ptr) {
+    MemArena* arena = (MemArena*)arena_ptr;
+    if (arena == NULL) return;
+
+    ArenaChunk* chunk = arena->first->next;
+    while (chunk != NULL) {
+        ArenaChunk* next = chunk->next;
+        mem_free(chunk);
+        chunk = next;
+    }
+    arena->first->next = NULL;
+    arena->first->used = 0;
+    arena->current = arena->first;
+}
+
+/**
+ * Destroy the arena and return all its memory to the heap.
+ */
+void mem_arena_destroy(void* arena_ptr) {
+    MemArena* arena = (MemArena*)arena_ptr;
+    if (arena == NULL) return;
+
+    ArenaChunk* chunk = arena->first;
+    while (chunk != NULL) {
+        ArenaChunk* next = chunk->next;
+        mem_free(chunk);
+        chunk = next;
+    }
+    mem_free(arena);
 }
 
 // Aliases for compatibility
@@ -103,3 +706,16 @@ void* malloc(size_t size) {
 void free(void* ptr) {
     mem_free(ptr);
 }
+
+void* realloc(void* ptr, size_t size) {
+    return mem_realloc(ptr, size);
+}
+
+// Without this, libc's own calloc would hand out blocks that mem_free
+// then misinterprets as Wheel heap blocks
+void* calloc(size_t count, size_t size) {
+    if (size != 0 && count > ((size_t)-1) / size) return NULL;
+    void* ptr = mem_alloc(count * size);
+    if (ptr != NULL) memset(ptr, 0, count * size);
+    return ptr;
+}
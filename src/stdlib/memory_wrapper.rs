@@ -36,5 +36,33 @@ impl MemoryWrapper {
         // mem_get_free() -> size_t
         let get_free_fn_type = i64_t.fn_type(&[], false);
         module.add_function("mem_get_free", get_free_fn_type, None);
+
+        // mem_set_limit(bytes: size_t) -> void
+        let set_limit_fn_type = context.void_type().fn_type(&[i64_t.into()], false);
+        module.add_function("mem_set_limit", set_limit_fn_type, None);
+
+        // mem_realloc(ptr: *mut i8, size: size_t) -> void*
+        let realloc_fn_type = i8_ptr.fn_type(&[i8_ptr.into(), i64_t.into()], false);
+        module.add_function("mem_realloc", realloc_fn_type, None);
+
+        // mem_get_stats(out: *mut MemStats) -> void
+        let get_stats_fn_type = context.void_type().fn_type(&[i8_ptr.into()], false);
+        module.add_function("mem_get_stats", get_stats_fn_type, None);
+
+        // mem_arena_create(initial_size: size_t) -> void*
+        let arena_create_fn_type = i8_ptr.fn_type(&[i64_t.into()], false);
+        module.add_function("mem_arena_create", arena_create_fn_type, None);
+
+        // mem_arena_alloc(arena: void*, size: size_t) -> void*
+        let arena_alloc_fn_type = i8_ptr.fn_type(&[i8_ptr.into(), i64_t.into()], false);
+        module.add_function("mem_arena_alloc", arena_alloc_fn_type, None);
+
+        // mem_arena_reset(arena: void*) -> void
+        let arena_reset_fn_type = context.void_type().fn_type(&[i8_ptr.into()], false);
+        module.add_function("mem_arena_reset", arena_reset_fn_type, None);
+
+        // mem_arena_destroy(arena: void*) -> void
+        let arena_destroy_fn_type = context.void_type().fn_type(&[i8_ptr.into()], false);
+        module.add_function("mem_arena_destroy", arena_destroy_fn_type, None);
     }
 }
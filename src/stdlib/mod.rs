@@ -9,6 +9,8 @@ pub mod os_wrapper;
 pub mod memory_wrapper;
 pub mod filesystem_wrapper;
 pub mod process_wrapper;
+pub mod ipc_wrapper;
+pub mod stats_wrapper;
 
 // Re-export common APIs
 pub use sdl_wrapper::sdl;
@@ -18,3 +20,5 @@ pub use os_wrapper::os;
 pub use memory_wrapper::MemoryWrapper;
 pub use filesystem_wrapper::FilesystemWrapper;
 pub use process_wrapper::ProcessWrapper;
+pub use ipc_wrapper::IpcWrapper;
+pub use stats_wrapper::StatsWrapper;
@@ -5,6 +5,8 @@
 #include <sys/types.h>
 #include <time.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 // These wrapper functions provide the interface expected by Wheel
 // The actual system functions are called internally
@@ -24,3 +26,108 @@ int64_t wheel_sleep(int64_t seconds) {
     sleep(sec);
     return 1;
 }
+
+// Monotonic nanosecond clock for latency measurement: unaffected by
+// wall-clock adjustments, safe to subtract across calls
+int64_t wheel_time_monotonic_ns() {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) return -1;
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Coarse variant (~1ms granularity) that avoids the hardware clock
+// read, for timestamping in very hot loops
+int64_t wheel_time_monotonic_coarse_ns() {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &ts) != 0) return -1;
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// Sleep for the given number of nanoseconds, resuming across signals
+int64_t wheel_sleep_ns(int64_t nanoseconds) {
+    if (nanoseconds <= 0) return 0;
+    struct timespec req;
+    req.tv_sec = nanoseconds / 1000000000LL;
+    req.tv_nsec = nanoseconds % 1000000000LL;
+    struct timespec rem;
+    while (nanosleep(&req, &rem) != 0) {
+        req = rem;  // interrupted by a signal: sleep off the remainder
+    }
+    return 1;
+}
+
+// Sleep for the given number of milliseconds
+int64_t wheel_sleep_ms(int64_t milliseconds) {
+    return wheel_sleep_ns(milliseconds * 1000000LL);
+}
+
+// ---------------------------------------------------------------------------
+// Buffered output runtime. A print statement that goes straight to
+// write() costs a syscall per line; text-heavy Wheel programs spend
+// nearly all their time there. Printing into a 64KB buffer that
+// flushes when full, after a batch of lines, or at exit turns ~500k
+// writes into a few dozen.
+// ---------------------------------------------------------------------------
+
+#define WHEEL_OUT_BUF_SIZE (64 * 1024)
+#define WHEEL_OUT_LINE_FLUSH 1024  // flush after this many buffered lines
+
+static char wheel_out_buf[WHEEL_OUT_BUF_SIZE];
+static size_t wheel_out_len = 0;
+static int wheel_out_lines = 0;
+static int wheel_flush_registered = 0;
+
+/**
+ * Flush everything buffered by wheel_print_buffered to stdout
+ */
+void wheel_flush() {
+    size_t done = 0;
+    while (done < wheel_out_len) {
+        ssize_t n = write(1, wheel_out_buf + done, wheel_out_len - done);
+        if (n < 0) break;
+        done += n;
+    }
+    wheel_out_len = 0;
+    wheel_out_lines = 0;
+}
+
+/**
+ * Print a string through the output buffer. Generated code calls this
+ * instead of writing per statement; the buffer reaches the terminal
+ * when it fills, every WHEEL_OUT_LINE_FLUSH lines, or at exit.
+ */
+void wheel_print_buffered(const char* text) {
+    if (text == 0) return;
+
+    if (!wheel_flush_registered) {
+        atexit(wheel_flush);
+        wheel_flush_registered = 1;
+    }
+
+    size_t len = strlen(text);
+
+    // Oversized payloads bypass the buffer (in order: flush first)
+    if (len >= WHEEL_OUT_BUF_SIZE) {
+        wheel_flush();
+        size_t done = 0;
+        while (done < len) {
+            ssize_t n = write(1, text + done, len - done);
+            if (n < 0) break;
+            done += n;
+        }
+        return;
+    }
+
+    if (wheel_out_len + len > WHEEL_OUT_BUF_SIZE) {
+        wheel_flush();
+    }
+    memcpy(wheel_out_buf + wheel_out_len, text, len);
+    wheel_out_len += len;
+
+    for (size_t i = 0; i < len; i++) {
+        if (text[i] == '\n') wheel_out_lines++;
+    }
+    if (wheel_out_lines >= WHEEL_OUT_LINE_FLUSH) {
+        wheel_flush();
+    }
+}
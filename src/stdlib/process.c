@@ -3,12 +3,28 @@
  * Simple process creation and scheduling
  */
 
+#define _GNU_SOURCE  // pipe2
+
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <sys/resource.h>
 #include <signal.h>
+#include <spawn.h>
 #include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/syscall.h>
+#include <errno.h>
+
+#ifndef __NR_pidfd_open
+#define __NR_pidfd_open 434
+#endif
+
+#include "wheel_stats.h"
+
+extern char** environ;
 
 #define MAX_PROCESSES 256
 
@@ -16,6 +32,7 @@ typedef struct {
     pid_t pid;
     int status;
     int is_running;
+    int pidfd;  // registered with the reaper epoll; -1 if unavailable
 } Process;
 
 static Process processes[MAX_PROCESSES];
@@ -24,57 +41,196 @@ static int process_count = 0;
 /**
  * Initialize process management system
  */
+// epoll instance watching every child's pidfd, created on first use
+static int reaper_epfd = -1;
+
+// ---------------------------------------------------------------------------
+// SIGCHLD reaper: records exit statuses into the process table as
+// children die, so process_is_running/process_wait are plain memory
+// reads in the common case instead of a waitpid syscall per call.
+// ---------------------------------------------------------------------------
+
+static volatile sig_atomic_t reaper_installed = 0;
+
+static void sigchld_reaper(int sig) {
+    (void)sig;
+    int saved_errno = errno;
+    int status;
+    pid_t pid;
+    // Reap everything that's ready; only async-signal-safe work here
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        for (int i = 0; i < process_count; i++) {
+            if (processes[i].pid == pid && processes[i].is_running) {
+                processes[i].status = status;
+                processes[i].is_running = 0;
+                break;
+            }
+        }
+    }
+    errno = saved_errno;
+}
+
+static void install_reaper() {
+    if (!reaper_installed) {
+        struct sigaction sa;
+        sa.sa_handler = sigchld_reaper;
+        sigemptyset(&sa.sa_mask);
+        sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+        sigaction(SIGCHLD, &sa, NULL);
+        reaper_installed = 1;
+    }
+}
+
 void process_init() {
+    install_reaper();
     for (int i = 0; i < MAX_PROCESSES; i++) {
         processes[i].pid = -1;
         processes[i].status = 0;
         processes[i].is_running = 0;
+        processes[i].pidfd = -1;
     }
     process_count = 0;
 }
 
+// Record a spawned child in the process table, returning its handle.
+// The child's pidfd goes into the reaper epoll so process_wait_any can
+// block on all children at once with constant per-event cost.
+static long register_child(pid_t child_pid) {
+    wheel_stat_add(WHEEL_STAT_PROC_SPAWNED, 1);
+    int handle = process_count;
+    processes[handle].pid = child_pid;
+    processes[handle].status = 0;
+    processes[handle].is_running = 1;
+    processes[handle].pidfd = (int)syscall(__NR_pidfd_open, child_pid, 0);
+    
+    if (processes[handle].pidfd >= 0) {
+        if (reaper_epfd < 0) {
+            reaper_epfd = epoll_create1(EPOLL_CLOEXEC);
+        }
+        if (reaper_epfd >= 0) {
+            struct epoll_event ev;
+            ev.events = EPOLLIN;  // pidfd becomes readable on child exit
+            ev.data.u64 = (unsigned long)handle;
+            epoll_ctl(reaper_epfd, EPOLL_CTL_ADD, processes[handle].pidfd, &ev);
+        }
+    }
+    
+    process_count++;
+    return handle;
+}
+
+// Drop a reaped child's pidfd from the epoll set
+static void unregister_child(long handle) {
+    if (processes[handle].pidfd >= 0) {
+        if (reaper_epfd >= 0) {
+            epoll_ctl(reaper_epfd, EPOLL_CTL_DEL, processes[handle].pidfd, NULL);
+        }
+        close(processes[handle].pidfd);
+        processes[handle].pidfd = -1;
+    }
+}
+
 /**
  * Create a new child process
  * Returns process ID or -1 on error
  */
 long process_create(const char* command) {
     if (process_count >= MAX_PROCESSES) return -1;
+    install_reaper();
+    
+    // Keep the reaper from firing between spawn and registration,
+    // where it couldn't find the pid in the table yet
+    sigset_t block, old;
+    sigemptyset(&block);
+    sigaddset(&block, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &block, &old);
     
     pid_t child_pid = fork();
     
     if (child_pid < 0) {
         // Fork failed
+        sigprocmask(SIG_SETMASK, &old, NULL);
         return -1;
     } else if (child_pid == 0) {
         // Child process: execute command via shell
+        sigprocmask(SIG_SETMASK, &old, NULL);
         execl("/bin/sh", "sh", "-c", command, NULL);
         // If execl returns, an error occurred
         _exit(127);
     } else {
         // Parent process: record new child
-        processes[process_count].pid = child_pid;
-        processes[process_count].status = 0;
-        processes[process_count].is_running = 1;
-        int handle = process_count;
-        process_count++;
+        long handle = register_child(child_pid);
+        sigprocmask(SIG_SETMASK, &old, NULL);
         return handle;
     }
 }
 
+/**
+ * Create a new child process directly from a program path and argv,
+ * without a shell. posix_spawn takes the vfork/CLONE_VM path, so a
+ * large parent doesn't pay to duplicate its address space per spawn.
+ * @param path: program to execute
+ * @param argv: NULL-terminated argument vector (argv[0] = program name)
+ * Returns process handle or -1 on error
+ */
+long process_create_argv(const char* path, char* const argv[]) {
+    if (process_count >= MAX_PROCESSES) return -1;
+    if (path == NULL || argv == NULL) return -1;
+    install_reaper();
+    
+    sigset_t block, old;
+    sigemptyset(&block);
+    sigaddset(&block, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &block, &old);
+    
+    pid_t child_pid;
+    if (posix_spawn(&child_pid, path, NULL, NULL, argv, environ) != 0) {
+        sigprocmask(SIG_SETMASK, &old, NULL);
+        return -1;
+    }
+    long handle = register_child(child_pid);
+    sigprocmask(SIG_SETMASK, &old, NULL);
+    return handle;
+}
+
 /**
  * Wait for a process to complete
  * Returns exit status or -1 on error
  */
 long process_wait(long pid_handle) {
     if (pid_handle < 0 || pid_handle >= process_count) return -1;
+    wheel_stat_add(WHEEL_STAT_PROC_WAITS, 1);
+    
+    // Already reaped (e.g. by the SIGCHLD reaper): plain memory read.
+    // Still drop the pidfd from the reaper epoll, or process_wait_any
+    // would report this handle again as a fresh completion.
+    if (!processes[pid_handle].is_running) {
+        unregister_child(pid_handle);
+        int status = processes[pid_handle].status;
+        if (WIFEXITED(status)) {
+            return WEXITSTATUS(status);
+        }
+        return -1;
+    }
     
     int status;
     pid_t result = waitpid(processes[pid_handle].pid, &status, 0);
     
-    if (result < 0) return -1;
+    if (result < 0) {
+        // The SIGCHLD reaper may have claimed the child first
+        if (!processes[pid_handle].is_running) {
+            status = processes[pid_handle].status;
+            unregister_child(pid_handle);
+            if (WIFEXITED(status)) {
+                return WEXITSTATUS(status);
+            }
+        }
+        return -1;
+    }
     
     processes[pid_handle].is_running = 0;
     processes[pid_handle].status = status;
+    unregister_child(pid_handle);
     
     if (WIFEXITED(status)) {
         return WEXITSTATUS(status);
@@ -82,13 +238,48 @@ long process_wait(long pid_handle) {
     return -1;
 }
 
+/**
+ * Block until any child exits, scaling to thousands of children: one
+ * epoll_wait replaces a waitpid(WNOHANG) poll over the whole table.
+ * @param timeout_ms: max wait in milliseconds (-1 = forever)
+ * @return: handle of the finished child (query its status with
+ *          process_wait), or -1 on timeout or when nothing is running
+ */
+long process_wait_any(long timeout_ms) {
+    if (reaper_epfd < 0) return -1;
+    wheel_stat_add(WHEEL_STAT_PROC_WAITS, 1);
+    
+    struct epoll_event ev;
+    int n = epoll_wait(reaper_epfd, &ev, 1, (int)timeout_ms);
+    if (n <= 0) return -1;
+    
+    long handle = (long)ev.data.u64;
+    
+    // Reap through the pidfd and record the status for process_wait
+    siginfo_t info;
+    if (waitid(P_PIDFD, (id_t)processes[handle].pidfd, &info, WEXITED) == 0) {
+        // Re-encode in waitpid status format so WIFEXITED et al. work
+        if (info.si_code == CLD_EXITED) {
+            processes[handle].status = (info.si_status & 0xff) << 8;
+        } else {
+            processes[handle].status = info.si_status & 0x7f;
+        }
+        processes[handle].is_running = 0;
+    }
+    unregister_child(handle);
+    return handle;
+}
+
 /**
  * Check if process is running
  */
 long process_is_running(long pid_handle) {
     if (pid_handle < 0 || pid_handle >= process_count) return -1;
     
-    if (!processes[pid_handle].is_running) return 0;
+    if (!processes[pid_handle].is_running) {
+        unregister_child(pid_handle);  // reaped: retire the pidfd too
+        return 0;
+    }
     
     // Check with waitpid WNOHANG to see if process has exited
     int status;
@@ -99,9 +290,16 @@ long process_is_running(long pid_handle) {
     } else if (result > 0) {
         processes[pid_handle].is_running = 0;
         processes[pid_handle].status = status;
+        unregister_child(pid_handle);
         return 0;  // Process exited
     }
     
+    // The SIGCHLD reaper may have claimed the child between our
+    // is_running check and the waitpid
+    if (!processes[pid_handle].is_running) {
+        unregister_child(pid_handle);
+        return 0;
+    }
     return -1;  // Error
 }
 
@@ -169,6 +367,172 @@ long process_get_memory(long pid_handle) {
     return (long)(usage.ru_maxrss);
 }
 
+// ---------------------------------------------------------------------------
+// Worker pool: N long-lived children running the same command, fed
+// newline-delimited tasks over pipes. Dispatch is a pipe write
+// (microseconds) instead of a process spawn (milliseconds), and
+// submissions pipeline across all workers round-robin.
+// ---------------------------------------------------------------------------
+
+#define MAX_POOLS 8
+#define POOL_MAX_WORKERS 64
+
+typedef struct {
+    pid_t pid;
+    int to_fd;    // our write end of the worker's stdin
+    int from_fd;  // our read end of the worker's stdout (non-blocking)
+} PoolWorker;
+
+typedef struct {
+    int in_use;
+    int n_workers;
+    int next_rr;  // round-robin dispatch cursor
+    PoolWorker workers[POOL_MAX_WORKERS];
+} ProcessPool;
+
+static ProcessPool pools[MAX_POOLS];
+
+// Spawn one worker running the command with piped stdin/stdout
+static int pool_spawn_worker(PoolWorker* w, const char* command) {
+    int to_child[2];    // we write, child reads as stdin
+    int from_child[2];  // child writes as stdout, we read
+    
+    // O_CLOEXEC so later workers don't inherit this worker's pipe ends
+    // (an inherited write end would keep its stdin open past our close);
+    // the dup2 file actions below clear the flag on the child's own copies
+    if (pipe2(to_child, O_CLOEXEC) < 0) return -1;
+    if (pipe2(from_child, O_CLOEXEC) < 0) {
+        close(to_child[0]);
+        close(to_child[1]);
+        return -1;
+    }
+    
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, to_child[0], 0);
+    posix_spawn_file_actions_adddup2(&actions, from_child[1], 1);
+    
+    char* argv[] = {"sh", "-c", (char*)command, NULL};
+    pid_t pid;
+    int rc = posix_spawn(&pid, "/bin/sh", &actions, NULL, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+    
+    close(to_child[0]);
+    close(from_child[1]);
+    if (rc != 0) {
+        close(to_child[1]);
+        close(from_child[0]);
+        return -1;
+    }
+    
+    // Results are drained opportunistically, so reads must not block
+    fcntl(from_child[0], F_SETFL, O_NONBLOCK);
+    
+    w->pid = pid;
+    w->to_fd = to_child[1];
+    w->from_fd = from_child[0];
+    return 0;
+}
+
+static void pool_stop_worker(PoolWorker* w) {
+    close(w->to_fd);    // EOF on stdin tells the worker to exit
+    close(w->from_fd);
+    waitpid(w->pid, NULL, 0);
+}
+
+/**
+ * Start a pool of n_workers children all running command
+ * Returns pool handle or -1 on error
+ */
+long pool_create(long n_workers, const char* command) {
+    if (n_workers <= 0 || n_workers > POOL_MAX_WORKERS || command == NULL) return -1;
+    
+    ProcessPool* pool = NULL;
+    for (int i = 0; i < MAX_POOLS; i++) {
+        if (!pools[i].in_use) {
+            pool = &pools[i];
+            break;
+        }
+    }
+    if (pool == NULL) return -1;
+    
+    for (int i = 0; i < n_workers; i++) {
+        if (pool_spawn_worker(&pool->workers[i], command) < 0) {
+            for (int k = 0; k < i; k++) {
+                pool_stop_worker(&pool->workers[k]);
+            }
+            return -1;
+        }
+    }
+    
+    pool->in_use = 1;
+    pool->n_workers = (int)n_workers;
+    pool->next_rr = 0;
+    return pool - pools;
+}
+
+/**
+ * Dispatch a task line to the next worker (round-robin). The task is
+ * written to the worker's stdin with a trailing newline.
+ * Returns the worker index the task went to, or -1 on error
+ */
+long pool_submit(long pool_handle, const char* task) {
+    if (pool_handle < 0 || pool_handle >= MAX_POOLS || task == NULL) return -1;
+    
+    ProcessPool* pool = &pools[pool_handle];
+    if (!pool->in_use) return -1;
+    
+    int worker = pool->next_rr;
+    pool->next_rr = (pool->next_rr + 1) % pool->n_workers;
+    
+    int fd = pool->workers[worker].to_fd;
+    size_t len = strlen(task);
+    size_t sent = 0;
+    while (sent < len) {
+        ssize_t n = write(fd, task + sent, len - sent);
+        if (n < 0) return -1;
+        sent += n;
+    }
+    if (write(fd, "\n", 1) != 1) return -1;
+    return worker;
+}
+
+/**
+ * Drain whatever output the workers have produced so far into buffer
+ * (non-blocking; results from different workers arrive interleaved
+ * line-wise, so keep tasks to one result line each)
+ * @return: number of bytes collected, 0 if nothing is ready yet
+ */
+long pool_poll_results(long pool_handle, char* buffer, long max) {
+    if (pool_handle < 0 || pool_handle >= MAX_POOLS) return -1;
+    if (buffer == NULL || max <= 0) return -1;
+    
+    ProcessPool* pool = &pools[pool_handle];
+    if (!pool->in_use) return -1;
+    
+    long total = 0;
+    for (int i = 0; i < pool->n_workers && total < max; i++) {
+        ssize_t n = read(pool->workers[i].from_fd, buffer + total, max - total);
+        if (n > 0) total += n;
+    }
+    return total;
+}
+
+/**
+ * Shut the pool down: close worker stdins (EOF) and reap the children
+ */
+void pool_destroy(long pool_handle) {
+    if (pool_handle < 0 || pool_handle >= MAX_POOLS) return;
+    
+    ProcessPool* pool = &pools[pool_handle];
+    if (!pool->in_use) return;
+    
+    for (int i = 0; i < pool->n_workers; i++) {
+        pool_stop_worker(&pool->workers[i]);
+    }
+    pool->in_use = 0;
+}
+
 // Include sched_yield header at compile time if available
 #ifndef _BSD_SOURCE
 #define _BSD_SOURCE
@@ -24,10 +24,18 @@ impl ProcessWrapper {
         let create_fn_type = i64_t.fn_type(&[i8_ptr.into()], false);
         module.add_function("process_create", create_fn_type, None);
 
+        // process_create_argv(path: *const i8, argv: *const *const i8) -> i64
+        let create_argv_fn_type = i64_t.fn_type(&[i8_ptr.into(), i8_ptr.into()], false);
+        module.add_function("process_create_argv", create_argv_fn_type, None);
+
         // process_wait(pid: i64) -> i64
         let wait_fn_type = i64_t.fn_type(&[i64_t.into()], false);
         module.add_function("process_wait", wait_fn_type, None);
 
+        // process_wait_any(timeout_ms: i64) -> i64
+        let wait_any_fn_type = i64_t.fn_type(&[i64_t.into()], false);
+        module.add_function("process_wait_any", wait_any_fn_type, None);
+
         // process_is_running(pid: i64) -> i64
         let is_running_fn_type = i64_t.fn_type(&[i64_t.into()], false);
         module.add_function("process_is_running", is_running_fn_type, None);
@@ -55,5 +63,22 @@ impl ProcessWrapper {
         // process_set_priority(pid: i64, priority: i64) -> i64
         let set_prio_fn_type = i64_t.fn_type(&[i64_t.into(), i64_t.into()], false);
         module.add_function("process_set_priority", set_prio_fn_type, None);
+
+        // pool_create(n_workers: i64, command: *const i8) -> i64
+        let pool_create_fn_type = i64_t.fn_type(&[i64_t.into(), i8_ptr.into()], false);
+        module.add_function("pool_create", pool_create_fn_type, None);
+
+        // pool_submit(pool: i64, task: *const i8) -> i64
+        let pool_submit_fn_type = i64_t.fn_type(&[i64_t.into(), i8_ptr.into()], false);
+        module.add_function("pool_submit", pool_submit_fn_type, None);
+
+        // pool_poll_results(pool: i64, buffer: *mut i8, max: i64) -> i64
+        let pool_poll_fn_type =
+            i64_t.fn_type(&[i64_t.into(), i8_ptr.into(), i64_t.into()], false);
+        module.add_function("pool_poll_results", pool_poll_fn_type, None);
+
+        // pool_destroy(pool: i64) -> void
+        let pool_destroy_fn_type = context.void_type().fn_type(&[i64_t.into()], false);
+        module.add_function("pool_destroy", pool_destroy_fn_type, None);
     }
 }
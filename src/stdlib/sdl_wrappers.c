@@ -57,6 +57,86 @@ int64_t sdl_draw_rect(int32_t x, int32_t y, int32_t w, int32_t h, uint8_t r, uin
     return result == 0 ? 1 : 0;
 }
 
+// Batch of points the renderer can take in one call; also bounds the
+// stack space used for converting Wheel arrays
+#define SDL_BATCH 4096
+
+// Draw many pixels in one call: xs/ys are i64 arrays from Wheel memory,
+// colors packs 0xRRGGBB per pixel. Consecutive same-color runs become a
+// single SDL_RenderDrawPoints call, so a particle frame is a handful of
+// renderer calls instead of one FFI round trip per pixel.
+int64_t sdl_draw_pixels(int64_t xs_ptr, int64_t ys_ptr, int64_t colors_ptr, int64_t count) {
+    if (!wheel_renderer) return 0;
+    if (!xs_ptr || !ys_ptr || !colors_ptr || count <= 0) return 0;
+
+    const int64_t* xs = (const int64_t*)xs_ptr;
+    const int64_t* ys = (const int64_t*)ys_ptr;
+    const int64_t* colors = (const int64_t*)colors_ptr;
+
+    SDL_Point batch[SDL_BATCH];
+    int64_t i = 0;
+    while (i < count) {
+        int64_t color = colors[i];
+        int n = 0;
+        // Collect the run of pixels sharing this color
+        while (i < count && colors[i] == color && n < SDL_BATCH) {
+            batch[n].x = (int)xs[i];
+            batch[n].y = (int)ys[i];
+            n++;
+            i++;
+        }
+        SDL_SetRenderDrawColor(wheel_renderer,
+                               (uint8_t)(color >> 16), (uint8_t)(color >> 8),
+                               (uint8_t)color, 255);
+        if (SDL_RenderDrawPoints(wheel_renderer, batch, n) != 0) return 0;
+    }
+    return 1;
+}
+
+// Fill many rectangles of one color in one call: rects is an i64 array
+// of x,y,w,h quadruples from Wheel memory
+int64_t sdl_draw_rects(int64_t rects_ptr, int64_t count, uint8_t r, uint8_t g, uint8_t b) {
+    if (!wheel_renderer) return 0;
+    if (!rects_ptr || count <= 0) return 0;
+
+    const int64_t* vals = (const int64_t*)rects_ptr;
+    SDL_SetRenderDrawColor(wheel_renderer, r, g, b, 255);
+
+    SDL_Rect batch[SDL_BATCH];
+    int64_t done = 0;
+    while (done < count) {
+        int n = 0;
+        while (done < count && n < SDL_BATCH) {
+            batch[n].x = (int)vals[done * 4];
+            batch[n].y = (int)vals[done * 4 + 1];
+            batch[n].w = (int)vals[done * 4 + 2];
+            batch[n].h = (int)vals[done * 4 + 3];
+            n++;
+            done++;
+        }
+        if (SDL_RenderFillRects(wheel_renderer, batch, n) != 0) return 0;
+    }
+    return 1;
+}
+
+// Draw a connected polyline of one color: xs/ys are i64 arrays of
+// count vertices
+int64_t sdl_draw_lines(int64_t xs_ptr, int64_t ys_ptr, int64_t count, uint8_t r, uint8_t g, uint8_t b) {
+    if (!wheel_renderer) return 0;
+    if (!xs_ptr || !ys_ptr || count < 2 || count > SDL_BATCH) return 0;
+
+    const int64_t* xs = (const int64_t*)xs_ptr;
+    const int64_t* ys = (const int64_t*)ys_ptr;
+
+    SDL_Point pts[SDL_BATCH];
+    for (int64_t i = 0; i < count; i++) {
+        pts[i].x = (int)xs[i];
+        pts[i].y = (int)ys[i];
+    }
+    SDL_SetRenderDrawColor(wheel_renderer, r, g, b, 255);
+    return SDL_RenderDrawLines(wheel_renderer, pts, (int)count) == 0 ? 1 : 0;
+}
+
 int64_t sdl_clear(uint8_t r, uint8_t g, uint8_t b) {
     if (!wheel_renderer) return 0;
     
@@ -72,7 +152,76 @@ int64_t sdl_present() {
     return 1;
 }
 
+// Streaming-texture framebuffer: Wheel code writes pixels straight into
+// the locked texture memory, and presenting is one GPU upload per frame
+// instead of hundreds of thousands of renderer calls.
+static SDL_Texture* wheel_framebuffer = NULL;
+static void* fb_pixels = NULL;
+static int fb_pitch = 0;
+
+int64_t sdl_destroy_framebuffer(void);
+
+// Create a w x h ARGB8888 framebuffer texture for the current window
+int64_t sdl_create_framebuffer(int32_t w, int32_t h) {
+    if (!wheel_renderer || w <= 0 || h <= 0) return 0;
+
+    // Tear down any previous framebuffer through the full destroy path:
+    // it unlocks first, so a stale fb_pixels can't be handed out again
+    sdl_destroy_framebuffer();
+    wheel_framebuffer = SDL_CreateTexture(wheel_renderer,
+                                          SDL_PIXELFORMAT_ARGB8888,
+                                          SDL_TEXTUREACCESS_STREAMING,
+                                          w, h);
+    if (!wheel_framebuffer) return 0;
+    return 1;
+}
+
+// Lock the framebuffer for writing; returns the pixel base pointer
+// (rows are sdl_get_framebuffer_pitch() bytes apart, pixels 0xAARRGGBB)
+int64_t sdl_lock_framebuffer() {
+    if (!wheel_framebuffer) return 0;
+    if (fb_pixels) return (int64_t)fb_pixels;  // already locked
+
+    if (SDL_LockTexture(wheel_framebuffer, NULL, &fb_pixels, &fb_pitch) != 0) {
+        fb_pixels = NULL;
+        return 0;
+    }
+    return (int64_t)fb_pixels;
+}
+
+// Bytes per framebuffer row (valid after sdl_lock_framebuffer)
+int64_t sdl_get_framebuffer_pitch() {
+    return fb_pitch;
+}
+
+// Unlock, upload and present the framebuffer in one call
+int64_t sdl_present_framebuffer() {
+    if (!wheel_renderer || !wheel_framebuffer) return 0;
+
+    if (fb_pixels) {
+        SDL_UnlockTexture(wheel_framebuffer);
+        fb_pixels = NULL;
+    }
+    if (SDL_RenderCopy(wheel_renderer, wheel_framebuffer, NULL, NULL) != 0) return 0;
+    SDL_RenderPresent(wheel_renderer);
+    return 1;
+}
+
+int64_t sdl_destroy_framebuffer() {
+    if (fb_pixels && wheel_framebuffer) {
+        SDL_UnlockTexture(wheel_framebuffer);
+    }
+    fb_pixels = NULL;
+    fb_pitch = 0;
+    if (wheel_framebuffer) {
+        SDL_DestroyTexture(wheel_framebuffer);
+        wheel_framebuffer = NULL;
+    }
+    return 1;
+}
+
 int64_t sdl_destroy_window() {
+    sdl_destroy_framebuffer();
     if (wheel_renderer) {
         SDL_DestroyRenderer(wheel_renderer);
         wheel_renderer = NULL;
@@ -84,52 +233,224 @@ int64_t sdl_destroy_window() {
     return 1;
 }
 
+// Size of the multi-window handle table further down; defined here so
+// sdl_quit can tear every handle down
+#define MAX_WINDOWS 8
+
+int64_t sdl_destroy_window_h(int64_t handle);
+
 int64_t sdl_quit() {
     sdl_destroy_window();
+    for (int i = 0; i < MAX_WINDOWS; i++) {
+        sdl_destroy_window_h(i);
+    }
     SDL_Quit();
     return 1;
 }
 
+// Event logging is compiled out of the hot input path by default;
+// build with -DWHEEL_SDL_EVENT_LOG to trace events to sdl_events.log
+#ifdef WHEEL_SDL_EVENT_LOG
+#include <stdio.h>
+static void log_event(const SDL_Event* e) {
+    FILE* f = fopen("sdl_events.log", "a");
+    if (f) {
+        if (e->type == SDL_QUIT) {
+            fprintf(f, "SDL_QUIT\n");
+        } else if (e->type == SDL_KEYDOWN) {
+            fprintf(f, "KEYDOWN: keysym=%d\n", e->key.keysym.sym);
+        } else {
+            fprintf(f, "event type: %d\n", e->type);
+        }
+        fclose(f);
+    }
+}
+#else
+#define log_event(e) ((void)0)
+#endif
+
+// Map an SDL event to a Wheel event code: 1-4 = up/left/down/right,
+// -1 = quit, -2 = escape, 0 = something we don't surface
+static int64_t translate_event(const SDL_Event* e) {
+    if (e->type == SDL_QUIT) return -1;
+    if (e->type == SDL_KEYDOWN) {
+        switch (e->key.keysym.sym) {
+            case SDLK_w: return 1; // up
+            case SDLK_a: return 2; // left
+            case SDLK_s: return 3; // down
+            case SDLK_d: return 4; // right
+            case SDLK_UP: return 1;
+            case SDLK_LEFT: return 2;
+            case SDLK_DOWN: return 3;
+            case SDLK_RIGHT: return 4;
+            case SDLK_ESCAPE: return -2; // escape
+        }
+    }
+    return 0;
+}
+
 // Poll for SDL events and return key codes or -1 for quit, 0 for none
 int64_t sdl_poll_event() {
     if (!wheel_renderer && !wheel_window) return 0;
     SDL_Event e;
     while (SDL_PollEvent(&e)) {
-        // log events for debugging
-        FILE *f = fopen("/workspaces/Wheel/sdl_events.log", "a");
-        if (f) {
-            fprintf(f, "event type: %d\n", e.type);
-        }
-        if (f) fclose(f);
-        if (e.type == SDL_QUIT) {
-            FILE *f2 = fopen("/workspaces/Wheel/sdl_events.log", "a");
-            if (f2) { fprintf(f2, "SDL_QUIT\n"); fclose(f2); }
-            return -1;
-        }
-        if (e.type == SDL_KEYDOWN) {
-            FILE *f3 = fopen("/workspaces/Wheel/sdl_events.log", "a");
-            if (f3) { fprintf(f3, "KEYDOWN: keysym=%d\n", e.key.keysym.sym); fclose(f3); }
-            SDL_Keycode k = e.key.keysym.sym;
-            switch (k) {
-                case SDLK_w: return 1; // up
-                case SDLK_a: return 2; // left
-                case SDLK_s: return 3; // down
-                case SDLK_d: return 4; // right
-                case SDLK_UP: return 1;
-                case SDLK_LEFT: return 2;
-                case SDLK_DOWN: return 3;
-                case SDLK_RIGHT: return 4;
-                case SDLK_ESCAPE: return -2; // escape
-                default: return 0;
-            }
-        }
+        log_event(&e);
+        int64_t code = translate_event(&e);
+        if (e.type == SDL_QUIT || e.type == SDL_KEYDOWN) return code;
     }
     return 0;
 }
 
+// Drain the whole SDL event queue into a caller-provided i64 array in
+// one call, so queued input can't go stale under load
+// @return: number of event codes written
+int64_t sdl_poll_events(int64_t buffer_ptr, int64_t max) {
+    if (!wheel_renderer && !wheel_window) return 0;
+    if (!buffer_ptr || max <= 0) return 0;
+
+    int64_t* codes = (int64_t*)buffer_ptr;
+    int64_t n = 0;
+    SDL_Event e;
+    while (n < max && SDL_PollEvent(&e)) {
+        log_event(&e);
+        int64_t code = translate_event(&e);
+        if (code != 0) {
+            codes[n++] = code;
+        }
+    }
+    return n;
+}
+
 // Delay in milliseconds
 int64_t sdl_delay(int64_t ms) {
     if (ms <= 0) return 0;
     SDL_Delay((Uint32)ms);
     return 1;
 }
+
+// ---------------------------------------------------------------------------
+// Multi-window API: a handle table instead of the single global
+// window/renderer pair, so one process can drive several displays.
+// The legacy single-window calls above keep working independently.
+// (MAX_WINDOWS is defined near sdl_quit, which tears the table down.)
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    SDL_Window* window;
+    SDL_Renderer* renderer;
+    int in_use;
+    Uint64 last_frame_ms;  // for sdl_frame_pace
+} WheelWindow;
+
+static WheelWindow wheel_windows[MAX_WINDOWS];
+
+static SDL_Renderer* win_renderer(int64_t handle) {
+    if (handle < 0 || handle >= MAX_WINDOWS) return NULL;
+    if (!wheel_windows[handle].in_use) return NULL;
+    return wheel_windows[handle].renderer;
+}
+
+// Create a window, returning a handle all *_h draw calls take.
+// vsync != 0 creates the renderer with SDL_RENDERER_PRESENTVSYNC so
+// presentation blocks on the display instead of busy-waiting.
+int64_t sdl_create_window_h(int32_t width, int32_t height, int64_t title_ptr, int64_t vsync) {
+    int slot = -1;
+    for (int i = 0; i < MAX_WINDOWS; i++) {
+        if (!wheel_windows[i].in_use) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) return -1;
+
+    const char* title = (const char*)title_ptr;
+    SDL_Window* window = SDL_CreateWindow(
+        title,
+        SDL_WINDOWPOS_CENTERED,
+        SDL_WINDOWPOS_CENTERED,
+        width,
+        height,
+        SDL_WINDOW_SHOWN
+    );
+    if (!window) return -1;
+
+    Uint32 flags = SDL_RENDERER_ACCELERATED;
+    if (vsync) flags |= SDL_RENDERER_PRESENTVSYNC;
+    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, flags);
+    if (!renderer) {
+        SDL_DestroyWindow(window);
+        return -1;
+    }
+
+    wheel_windows[slot].window = window;
+    wheel_windows[slot].renderer = renderer;
+    wheel_windows[slot].in_use = 1;
+    wheel_windows[slot].last_frame_ms = SDL_GetTicks64();
+    return slot;
+}
+
+int64_t sdl_clear_h(int64_t handle, uint8_t r, uint8_t g, uint8_t b) {
+    SDL_Renderer* renderer = win_renderer(handle);
+    if (!renderer) return 0;
+    SDL_SetRenderDrawColor(renderer, r, g, b, 255);
+    return SDL_RenderClear(renderer) == 0 ? 1 : 0;
+}
+
+int64_t sdl_draw_pixel_h(int64_t handle, int32_t x, int32_t y, uint8_t r, uint8_t g, uint8_t b) {
+    SDL_Renderer* renderer = win_renderer(handle);
+    if (!renderer) return 0;
+    SDL_SetRenderDrawColor(renderer, r, g, b, 255);
+    return SDL_RenderDrawPoint(renderer, x, y) == 0 ? 1 : 0;
+}
+
+int64_t sdl_draw_rect_h(int64_t handle, int32_t x, int32_t y, int32_t w, int32_t h,
+                        uint8_t r, uint8_t g, uint8_t b) {
+    SDL_Renderer* renderer = win_renderer(handle);
+    if (!renderer) return 0;
+    SDL_SetRenderDrawColor(renderer, r, g, b, 255);
+    SDL_Rect rect = {x, y, w, h};
+    return SDL_RenderFillRect(renderer, &rect) == 0 ? 1 : 0;
+}
+
+int64_t sdl_present_h(int64_t handle) {
+    SDL_Renderer* renderer = win_renderer(handle);
+    if (!renderer) return 0;
+    SDL_RenderPresent(renderer);
+    wheel_windows[handle].last_frame_ms = SDL_GetTicks64();
+    return 1;
+}
+
+// Present a vsync-created window; with SDL_RENDERER_PRESENTVSYNC this
+// blocks until the display's next refresh instead of burning a core
+int64_t sdl_present_vsync(int64_t handle) {
+    return sdl_present_h(handle);
+}
+
+// Frame-pacing helper for windows without vsync: sleep whatever is
+// left of this frame's 1000/target_fps ms budget since the last present
+// @return: milliseconds slept
+int64_t sdl_frame_pace(int64_t handle, int64_t target_fps) {
+    if (handle < 0 || handle >= MAX_WINDOWS) return 0;
+    if (!wheel_windows[handle].in_use || target_fps <= 0) return 0;
+
+    Uint64 frame_ms = 1000 / (Uint64)target_fps;
+    Uint64 now = SDL_GetTicks64();
+    Uint64 elapsed = now - wheel_windows[handle].last_frame_ms;
+    if (elapsed >= frame_ms) return 0;  // already behind schedule
+
+    Uint32 wait = (Uint32)(frame_ms - elapsed);
+    SDL_Delay(wait);
+    return (int64_t)wait;
+}
+
+int64_t sdl_destroy_window_h(int64_t handle) {
+    if (handle < 0 || handle >= MAX_WINDOWS) return 0;
+    if (!wheel_windows[handle].in_use) return 0;
+
+    SDL_DestroyRenderer(wheel_windows[handle].renderer);
+    SDL_DestroyWindow(wheel_windows[handle].window);
+    wheel_windows[handle].renderer = NULL;
+    wheel_windows[handle].window = NULL;
+    wheel_windows[handle].in_use = 0;
+    return 1;
+}
@@ -0,0 +1,59 @@
+/**
+ * Runtime statistics surface for Wheel
+ * One place to read what a deployed binary has been doing: the
+ * allocator, filesystem and process subsystems increment counters on
+ * their hot paths (relaxed atomics, a few cycles each), and this
+ * module exports them as a snapshot or a human-readable dump - no
+ * debugger required.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wheel_stats.h"
+
+unsigned long wheel_stat_counters[WHEEL_STAT_COUNT];
+
+static const char* const wheel_stat_names[WHEEL_STAT_COUNT] = {
+    "mem_allocs",
+    "mem_frees",
+    "mem_bytes",
+    "fs_blocks_read",
+    "fs_blocks_written",
+    "fs_bytes_read",
+    "fs_bytes_written",
+    "proc_spawned",
+    "proc_waits",
+};
+
+/**
+ * Copy all counters into a caller buffer of WHEEL_STAT_COUNT slots,
+ * in the order of the slot enum in wheel_stats.h
+ * @return: number of slots written or -1 on error
+ */
+long wheel_stats_snapshot(long* buffer) {
+    if (buffer == 0) return -1;
+    for (int i = 0; i < WHEEL_STAT_COUNT; i++) {
+        buffer[i] = (long)__atomic_load_n(&wheel_stat_counters[i], __ATOMIC_RELAXED);
+    }
+    return WHEEL_STAT_COUNT;
+}
+
+/**
+ * Write every counter to stderr, one name=value line each
+ */
+void wheel_stats_dump() {
+    for (int i = 0; i < WHEEL_STAT_COUNT; i++) {
+        fprintf(stderr, "wheel_stats: %s=%lu\n", wheel_stat_names[i],
+                __atomic_load_n(&wheel_stat_counters[i], __ATOMIC_RELAXED));
+    }
+}
+
+// With WHEEL_STATS set in the environment, every run dumps its
+// counters at exit - production visibility without a rebuild
+__attribute__((constructor))
+static void wheel_stats_autodump_init(void) {
+    if (getenv("WHEEL_STATS") != NULL) {
+        atexit(wheel_stats_dump);
+    }
+}
@@ -0,0 +1,27 @@
+/**
+ * Runtime statistics wrapper for LLVM integration
+ */
+
+use inkwell::context::Context;
+use inkwell::module::Module;
+use inkwell::types::IntType;
+
+pub struct StatsWrapper;
+
+impl StatsWrapper {
+    pub fn generate_stats_functions<'ctx>(
+        context: &'ctx Context,
+        module: &Module<'ctx>,
+    ) {
+        let i64_t = context.i64_type();
+        let i8_ptr = context.i8_type().ptr_type(inkwell::AddressSpace::default());
+
+        // wheel_stats_snapshot(buffer: *mut i64) -> i64
+        let snapshot_fn_type = i64_t.fn_type(&[i8_ptr.into()], false);
+        module.add_function("wheel_stats_snapshot", snapshot_fn_type, None);
+
+        // wheel_stats_dump() -> void
+        let dump_fn_type = context.void_type().fn_type(&[], false);
+        module.add_function("wheel_stats_dump", dump_fn_type, None);
+    }
+}
@@ -0,0 +1,30 @@
+/**
+ * Shared performance-counter slots for the Wheel stdlib
+ * Subsystems bump these with relaxed atomics on their hot paths;
+ * stats.c owns the storage and the snapshot/dump surface.
+ */
+
+#ifndef WHEEL_STATS_H
+#define WHEEL_STATS_H
+
+enum {
+    WHEEL_STAT_MEM_ALLOCS,        // successful mem_alloc calls
+    WHEEL_STAT_MEM_FREES,         // mem_free calls
+    WHEEL_STAT_MEM_BYTES,         // bytes allocated (headers included)
+    WHEEL_STAT_FS_BLOCKS_READ,    // blocks read (cache hits included)
+    WHEEL_STAT_FS_BLOCKS_WRITTEN, // blocks written
+    WHEEL_STAT_FS_BYTES_READ,     // bytes of read I/O
+    WHEEL_STAT_FS_BYTES_WRITTEN,  // bytes of write I/O
+    WHEEL_STAT_PROC_SPAWNED,      // children spawned
+    WHEEL_STAT_PROC_WAITS,        // blocking waits issued
+    WHEEL_STAT_COUNT
+};
+
+extern unsigned long wheel_stat_counters[WHEEL_STAT_COUNT];
+
+// One relaxed add: cheap enough for every hot path
+static inline void wheel_stat_add(int slot, unsigned long amount) {
+    __atomic_add_fetch(&wheel_stat_counters[slot], amount, __ATOMIC_RELAXED);
+}
+
+#endif